@@ -22,6 +22,9 @@ struct PostgresBinaryReader {
 	}
 
 	bool Next() {
+		if (read_query_result) {
+			return NextResultRow();
+		}
 		Reset();
 		char *out_buffer;
 		int len = PQgetCopyData(con.GetConn(), &out_buffer, 0);
@@ -44,7 +47,46 @@ struct PostgresBinaryReader {
 		return true;
 	}
 
+	//! Reads the next row of a query that was sent in single-row mode with binary results - the row is converted into
+	//! a binary COPY tuple so that it can be read in exactly the same way as COPY data
+	bool NextResultRow() {
+		Reset();
+		PostgresResult result(PQgetResult(con.GetConn()));
+		if (!result.res) {
+			return false;
+		}
+		auto status = PQresultStatus(result.res);
+		if (status == PGRES_TUPLES_OK) {
+			// the end of the result - consume the nullptr that follows it
+			PostgresResult end_result(PQgetResult(con.GetConn()));
+			return false;
+		}
+		if (status != PGRES_SINGLE_TUPLE) {
+			throw IOException("Failed to execute query: %s", string(PQresultErrorMessage(result.res)));
+		}
+		auto field_count = PQnfields(result.res);
+		row_buffer.clear();
+		AppendRowInteger(htons(NumericCast<uint16_t>(field_count)));
+		for (int c = 0; c < field_count; c++) {
+			if (PQgetisnull(result.res, 0, c)) {
+				AppendRowInteger(htonl(static_cast<uint32_t>(-1)));
+				continue;
+			}
+			auto length = PQgetlength(result.res, 0, c);
+			AppendRowInteger(htonl(NumericCast<uint32_t>(length)));
+			row_buffer.append(PQgetvalue(result.res, 0, c), length);
+		}
+		// the row buffer is owned by the reader - buffer stays nullptr so that Reset does not free it
+		buffer_ptr = data_ptr_cast(&row_buffer[0]);
+		end = buffer_ptr + row_buffer.size();
+		return true;
+	}
+
 	void CheckResult() {
+		if (read_query_result) {
+			// the result of a query is fully consumed by NextResultRow
+			return;
+		}
 		auto result = PQgetResult(con.GetConn());
 		if (!result || PQresultStatus(result) != PGRES_COMMAND_OK) {
 			throw std::runtime_error("Failed to execute COPY: " + string(PQresultErrorMessage(result)));
@@ -62,6 +104,19 @@ struct PostgresBinaryReader {
 	bool Ready() {
 		return buffer_ptr != nullptr;
 	}
+	//! The unread part of the current message
+	const_data_ptr_t Position() const {
+		return buffer_ptr;
+	}
+	idx_t RemainingBytes() const {
+		return NumericCast<idx_t>(end - buffer_ptr);
+	}
+	//! Reads from a message that is owned by the caller
+	void SetBuffer(data_ptr_t start, data_ptr_t end_p) {
+		Reset();
+		buffer_ptr = start;
+		end = end_p;
+	}
 
 	void CheckHeader() {
 		auto magic_len = PostgresConversion::COPY_HEADER_LENGTH;
@@ -559,10 +614,22 @@ public:
 		}
 	}
 
+public:
+	//! Whether rows are read from the (single-row mode) result of a query rather than from COPY data
+	bool read_query_result = false;
+
+private:
+	template <class T>
+	void AppendRowInteger(T value) {
+		row_buffer.append(const_char_ptr_cast(&value), sizeof(T));
+	}
+
 private:
 	data_ptr_t buffer = nullptr;
 	data_ptr_t buffer_ptr = nullptr;
 	data_ptr_t end = nullptr;
+	//! The current row in query result mode
+	string row_buffer;
 	PostgresConnection &con;
 };
 
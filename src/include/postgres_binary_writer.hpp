@@ -12,6 +12,7 @@
 #include "duckdb/common/types/interval.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "postgres_conversion.hpp"
+#include "postgres_utils.hpp"
 
 namespace duckdb {
 
@@ -232,9 +233,146 @@ public:
 		WriteRawBlob(value);
 	}
 
-	void WriteArray(Vector &col, idx_t r, const vector<uint32_t> &dimensions, idx_t depth, uint32_t count) {
+	//! Write a DuckDB row id as a Postgres tid (block number, offset within the block)
+	void WriteCtid(row_t row_id) {
+		WriteRawInteger<int32_t>(sizeof(uint32_t) + sizeof(uint16_t));
+		WriteRawInteger<uint32_t>(uint32_t(row_id >> 16));
+		WriteRawInteger<uint16_t>(uint16_t(row_id & 0xFFFF));
+	}
+
+	void WriteJSONB(string_t value) {
+		// jsonb is sent as a version number followed by the textual representation
+		auto str_size = value.GetSize();
+		WriteRawInteger<int32_t>(NumericCast<int32_t>(str_size + 1));
+		WriteRawInteger<uint8_t>(1);
+		stream.WriteData(const_data_ptr_cast(value.GetData()), str_size);
+	}
+
+	//! Write a double as a Postgres NUMERIC, using the shortest representation that round-trips
+	void WriteDoubleAsNumeric(double value) {
+		if (std::isnan(value) || std::isinf(value)) {
+			uint16_t sign = std::isnan(value) ? NUMERIC_NAN : (value > 0 ? NUMERIC_PINF : NUMERIC_NINF);
+			WriteRawInteger<int32_t>(int32_t(sizeof(uint16_t)) * 4);
+			WriteRawInteger<uint16_t>(0);
+			WriteRawInteger<int16_t>(0);
+			WriteRawInteger<uint16_t>(sign);
+			WriteRawInteger<uint16_t>(0);
+			return;
+		}
+		char buffer[64];
+		for (int precision = 15; precision <= 17; precision++) {
+			snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, value);
+			if (strtod(buffer, nullptr) == value) {
+				break;
+			}
+		}
+		// the buffer now has the format [-]d.ddddde[+-]xx
+		// collect the significant digits and the position of the decimal point
+		char digits[32];
+		int32_t digit_count = 0;
+		const char *ptr = buffer;
+		bool is_negative = *ptr == '-';
+		if (is_negative) {
+			ptr++;
+		}
+		for (; *ptr && *ptr != 'e'; ptr++) {
+			if (*ptr != '.') {
+				digits[digit_count++] = *ptr;
+			}
+		}
+		int32_t decimal_point = 1 + (*ptr == 'e' ? atoi(ptr + 1) : 0);
+		// remove trailing zeros
+		while (digit_count > 0 && digits[digit_count - 1] == '0') {
+			digit_count--;
+		}
+		if (digit_count == 0 || (digit_count == 1 && digits[0] == '0')) {
+			// zero
+			WriteRawInteger<int32_t>(int32_t(sizeof(uint16_t)) * 4);
+			WriteRawInteger<uint16_t>(0);
+			WriteRawInteger<int16_t>(0);
+			WriteRawInteger<uint16_t>(NUMERIC_POS);
+			WriteRawInteger<uint16_t>(0);
+			return;
+		}
+		uint16_t scale = uint16_t(MaxValue<int32_t>(0, digit_count - decimal_point));
+		// align the digits so that the decimal point falls on an NBASE digit boundary
+		int32_t leading_zeros = ((decimal_point % DEC_DIGITS) + DEC_DIGITS) % DEC_DIGITS;
+		leading_zeros = leading_zeros == 0 ? 0 : DEC_DIGITS - leading_zeros;
+		int32_t weight = (decimal_point + leading_zeros) / DEC_DIGITS - 1;
+		int32_t total_digits = leading_zeros + digit_count;
+		int32_t ndigits = (total_digits + DEC_DIGITS - 1) / DEC_DIGITS;
+		WriteRawInteger<int32_t>(int32_t(sizeof(uint16_t)) * (4 + ndigits));
+		WriteRawInteger<uint16_t>(uint16_t(ndigits));
+		WriteRawInteger<int16_t>(int16_t(weight));
+		WriteRawInteger<uint16_t>(is_negative ? NUMERIC_NEG : NUMERIC_POS);
+		WriteRawInteger<uint16_t>(scale);
+		for (int32_t i = 0; i < ndigits; i++) {
+			uint16_t nbase_digit = 0;
+			for (int32_t d = i * DEC_DIGITS; d < (i + 1) * DEC_DIGITS; d++) {
+				auto digit_idx = d - leading_zeros;
+				nbase_digit *= 10;
+				if (digit_idx >= 0 && digit_idx < digit_count) {
+					nbase_digit += uint16_t(digits[digit_idx] - '0');
+				}
+			}
+			WriteRawInteger<uint16_t>(nbase_digit);
+		}
+	}
+
+	void WriteGeometry(Vector &col, idx_t r, const PostgresType &postgres_type) {
+		auto list_entry = FlatVector::GetData<list_entry_t>(col)[r];
+		auto &child_vector = ListVector::GetEntry(col);
+		auto child_data = FlatVector::GetData<double>(child_vector);
+		for (idx_t i = 0; i < list_entry.length; i++) {
+			if (FlatVector::IsNull(child_vector, list_entry.offset + i)) {
+				throw InvalidInputException("Postgres geometric types cannot contain NULL values");
+			}
+		}
+		idx_t expected_count;
+		switch (postgres_type.info) {
+		case PostgresTypeAnnotation::GEOM_LINE:
+		case PostgresTypeAnnotation::GEOM_CIRCLE:
+			expected_count = 3;
+			break;
+		case PostgresTypeAnnotation::GEOM_LINE_SEGMENT:
+		case PostgresTypeAnnotation::GEOM_BOX:
+			expected_count = 4;
+			break;
+		case PostgresTypeAnnotation::GEOM_PATH:
+			// whether or not a path is closed is not read - paths are copied in the text format instead
+			throw NotImplementedException("Postgres path values cannot be written in the binary COPY format");
+		case PostgresTypeAnnotation::GEOM_POLYGON:
+			if (list_entry.length % 2 != 0) {
+				throw InvalidInputException("Postgres polygon values require an even number of coordinates");
+			}
+			expected_count = list_entry.length;
+			break;
+		default:
+			throw InternalException("Unsupported type for WriteGeometry");
+		}
+		if (list_entry.length != expected_count) {
+			throw InvalidInputException("Expected %llu coordinates for Postgres geometric value, but found %llu",
+			                            expected_count, list_entry.length);
+		}
+		idx_t header_size = 0;
+		if (postgres_type.info == PostgresTypeAnnotation::GEOM_POLYGON) {
+			header_size = sizeof(int32_t);
+		}
+		WriteRawInteger<int32_t>(int32_t(header_size + expected_count * sizeof(double)));
+		if (header_size > 0) {
+			WriteRawInteger<int32_t>(int32_t(expected_count / 2));
+		}
+		for (idx_t i = 0; i < expected_count; i++) {
+			double value = child_data[list_entry.offset + i];
+			WriteRawInteger<uint64_t>(*reinterpret_cast<uint64_t *>(&value));
+		}
+	}
+
+	void WriteArray(Vector &col, idx_t r, const PostgresType &postgres_type, const vector<uint32_t> &dimensions,
+	                idx_t depth, uint32_t count) {
 		auto list_data = FlatVector::GetData<list_entry_t>(col);
 		auto &child_vector = ListVector::GetEntry(col);
+		auto &child_pg_type = postgres_type.children[0];
 		for (idx_t i = 0; i < count; i++) {
 			auto list_entry = list_data[r + i];
 			if (list_entry.length != dimensions[depth]) {
@@ -242,19 +380,19 @@ public:
 				                            "found a length mismatch (found %llu entries, expected %llu)",
 				                            list_entry.length, dimensions[depth]);
 			}
-			if (child_vector.GetType().id() == LogicalTypeId::LIST) {
+			if (PostgresUtils::IsPostgresArray(child_vector.GetType(), child_pg_type)) {
 				// multidimensional array - recurse
-				WriteArray(child_vector, list_entry.offset, dimensions, depth + 1, list_entry.length);
+				WriteArray(child_vector, list_entry.offset, child_pg_type, dimensions, depth + 1, list_entry.length);
 			} else {
 				// write the actual values
 				for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
-					WriteValue(child_vector, list_entry.offset + child_idx);
+					WriteValue(child_vector, list_entry.offset + child_idx, child_pg_type);
 				}
 			}
 		}
 	}
 
-	void WriteValue(Vector &col, idx_t r) {
+	void WriteValue(Vector &col, idx_t r, const PostgresType &postgres_type) {
 		if (FlatVector::IsNull(col, r)) {
 			WriteNull();
 			return;
@@ -278,7 +416,17 @@ public:
 		}
 		case LogicalTypeId::BIGINT: {
 			auto data = FlatVector::GetData<int64_t>(col)[r];
-			WriteInteger<int64_t>(data);
+			if (postgres_type.info == PostgresTypeAnnotation::CTID) {
+				WriteCtid(data);
+			} else {
+				WriteInteger<int64_t>(data);
+			}
+			break;
+		}
+		case LogicalTypeId::UINTEGER: {
+			// oid columns
+			auto data = FlatVector::GetData<uint32_t>(col)[r];
+			WriteInteger<uint32_t>(data);
 			break;
 		}
 		case LogicalTypeId::FLOAT: {
@@ -288,7 +436,11 @@ public:
 		}
 		case LogicalTypeId::DOUBLE: {
 			auto data = FlatVector::GetData<double>(col)[r];
-			WriteDouble(data);
+			if (postgres_type.info == PostgresTypeAnnotation::NUMERIC_AS_DOUBLE) {
+				WriteDoubleAsNumeric(data);
+			} else {
+				WriteDouble(data);
+			}
 			break;
 		}
 		case LogicalTypeId::DECIMAL: {
@@ -344,7 +496,11 @@ public:
 		}
 		case LogicalTypeId::VARCHAR: {
 			auto data = FlatVector::GetData<string_t>(col)[r];
-			WriteVarchar(data);
+			if (postgres_type.info == PostgresTypeAnnotation::JSONB) {
+				WriteJSONB(data);
+			} else {
+				WriteVarchar(data);
+			}
 			break;
 		}
 		case LogicalTypeId::BLOB: {
@@ -373,26 +529,35 @@ public:
 			break;
 		}
 		case LogicalTypeId::LIST: {
-			auto list_entry = FlatVector::GetData<list_entry_t>(col)[r];
-			auto value_oid = PostgresUtils::ToPostgresOid(ListType::GetChildType(type));
-			if (list_entry.length == 0) {
-				// empty list
-				WriteRawInteger<int32_t>(sizeof(uint32_t) * 3);
-				WriteRawInteger<uint32_t>(0);
-				WriteRawInteger<uint32_t>(0);
-				WriteRawInteger<uint32_t>(value_oid);
-				return;
+			if (!PostgresUtils::IsPostgresArray(type, postgres_type)) {
+				WriteGeometry(col, r, postgres_type);
+				break;
 			}
-			// compute how many dimensions we will write
+			// compute how many dimensions we will write and find the element type
 			vector<uint32_t> dimensions;
 			const_reference<Vector> current_vector = col;
+			const_reference<PostgresType> current_pg_type = postgres_type;
 			idx_t current_position = r;
-			while (current_vector.get().GetType().id() == LogicalTypeId::LIST) {
+			bool is_empty = false;
+			while (PostgresUtils::IsPostgresArray(current_vector.get().GetType(), current_pg_type.get())) {
 				auto current_entry = FlatVector::GetData<list_entry_t>(current_vector.get())[current_position];
+				if (current_entry.length == 0) {
+					is_empty = true;
+				}
 				dimensions.push_back(current_entry.length);
 				current_vector = ListVector::GetEntry(current_vector.get());
+				current_pg_type = current_pg_type.get().children[0];
 				current_position = current_entry.offset;
 			}
+			auto value_oid = PostgresUtils::ToPostgresOid(current_vector.get().GetType(), current_pg_type.get());
+			if (is_empty) {
+				// empty list
+				WriteRawInteger<int32_t>(sizeof(uint32_t) * 3);
+				WriteRawInteger<uint32_t>(0);
+				WriteRawInteger<uint32_t>(0);
+				WriteRawInteger<uint32_t>(value_oid);
+				return;
+			}
 
 			// list header
 			// record the location of the field size in the stream
@@ -407,7 +572,7 @@ public:
 				WriteRawInteger<uint32_t>(1);   // index lower bounds
 			}
 			// now recursively write the actual values
-			WriteArray(col, r, dimensions, 0, 1);
+			WriteArray(col, r, postgres_type, dimensions, 0, 1);
 
 			// after writing all list elements update the field size
 			auto end_position = stream.GetPosition();
@@ -417,14 +582,31 @@ public:
 		}
 		case LogicalTypeId::STRUCT: {
 			auto &child_entries = StructVector::GetEntries(col);
+			if (postgres_type.info == PostgresTypeAnnotation::GEOM_POINT) {
+				// points are sent as two doubles
+				for (auto &child : child_entries) {
+					if (FlatVector::IsNull(*child, r)) {
+						throw InvalidInputException("Postgres geometric types cannot contain NULL values");
+					}
+				}
+				WriteRawInteger<int32_t>(sizeof(double) * 2);
+				for (auto &child : child_entries) {
+					double value = FlatVector::GetData<double>(*child)[r];
+					WriteRawInteger<uint64_t>(*reinterpret_cast<uint64_t *>(&value));
+				}
+				break;
+			}
+			D_ASSERT(child_entries.size() == postgres_type.children.size());
 
 			auto start_position = stream.GetPosition();
 			WriteRawInteger<int32_t>(0);                     // data size (nop for now)
 			WriteRawInteger<uint32_t>(child_entries.size()); // column count
-			for (auto &child : child_entries) {
-				auto value_oid = PostgresUtils::ToPostgresOid(child->GetType());
+			for (idx_t c = 0; c < child_entries.size(); c++) {
+				auto &child = *child_entries[c];
+				auto &child_pg_type = postgres_type.children[c];
+				auto value_oid = PostgresUtils::ToPostgresOid(child.GetType(), child_pg_type);
 				WriteRawInteger<uint32_t>(value_oid); // value oid
-				WriteValue(*child, r);
+				WriteValue(child, r, child_pg_type);
 			}
 			auto end_position = stream.GetPosition();
 			// after writing all list elements update the field size
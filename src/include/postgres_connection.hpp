@@ -12,6 +12,8 @@
 #include "postgres_result.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 
+#include <chrono>
+
 namespace duckdb {
 class PostgresBinaryWriter;
 class PostgresTextWriter;
@@ -21,12 +23,41 @@ class PostgresTableEntry;
 class PostgresStatement;
 class PostgresResult;
 struct IndexInfo;
+class BaseAppender;
 
 struct OwnedPostgresConnection {
 	explicit OwnedPostgresConnection(PGconn *conn = nullptr);
 	~OwnedPostgresConnection();
 
 	PGconn *connection;
+	//! When the connection was opened
+	std::chrono::steady_clock::time_point opened_at;
+	//! When the connection was last returned to the connection pool
+	std::chrono::steady_clock::time_point idle_since;
+	//! The version of the server - queried once per connection
+	unique_ptr<PostgresVersion> version;
+	//! Statements that are sent together with the next query on the connection
+	vector<string> pending_statements;
+};
+
+//! The parameters of a parameterized query - typed values are encoded in the binary format of Postgres, while strings
+//! are sent untyped in the text format
+struct PostgresQueryParameters {
+	explicit PostgresQueryParameters(const vector<Value> &parameters);
+	// disable copy constructors - the pointers point into the encoded values
+	PostgresQueryParameters(const PostgresQueryParameters &other) = delete;
+	PostgresQueryParameters &operator=(const PostgresQueryParameters &) = delete;
+
+	//! The types of the parameters - 0 lets the server infer the type from the query
+	vector<Oid> types;
+	vector<string> values;
+	vector<const char *> value_pointers;
+	vector<int> lengths;
+	vector<int> formats;
+
+	idx_t Count() const {
+		return types.size();
+	}
 };
 
 class PostgresConnection {
@@ -42,12 +73,26 @@ public:
 
 public:
 	static PostgresConnection Open(const string &connection_string);
+	//! Opens multiple connections - the connections are established concurrently
+	static vector<PostgresConnection> OpenConcurrently(const string &connection_string, idx_t count);
 	void Execute(const string &query);
 	unique_ptr<PostgresResult> TryQuery(const string &query, optional_ptr<string> error_message = nullptr);
 	unique_ptr<PostgresResult> Query(const string &query);
 
 	//! Submits a set of queries to be executed in the connection.
 	vector<unique_ptr<PostgresResult>> ExecuteQueries(const string &queries);
+	//! Prepares the query as the unnamed statement and returns its description - together with any pending statements
+	//! this takes a single round trip
+	unique_ptr<PostgresResult> TryDescribe(const string &query, optional_ptr<string> error_message = nullptr,
+	                                       optional_ptr<const PostgresQueryParameters> parameters = nullptr);
+	//! Sends a parameterized query - the rows are returned one by one in the binary format, and are read using a
+	//! PostgresBinaryReader in query result mode
+	void SendQueryParams(const string &query, const PostgresQueryParameters &parameters);
+
+	//! Queues a statement that is sent together with the next query (e.g. the BEGIN of a lazily started transaction)
+	void QueueStatement(string statement);
+	bool HasPendingStatements();
+	void DiscardPendingStatements();
 
 	PostgresVersion GetPostgresVersion();
 
@@ -62,6 +107,9 @@ public:
 	void FinishCopyTo(PostgresCopyState &state);
 
 	void BeginCopyFrom(PostgresBinaryReader &reader, const string &query);
+	//! Runs a binary "COPY ... TO STDOUT" and appends the result to the appender - returns the amount of rows copied
+	idx_t CopyFrom(const string &query, const vector<LogicalType> &types, const vector<PostgresType> &postgres_types,
+	               BaseAppender &appender);
 
 	bool IsOpen();
 	void Close();
@@ -85,6 +133,7 @@ public:
 
 private:
 	PGresult *PQExecute(const string &query);
+	string TakePendingStatements();
 
 	shared_ptr<OwnedPostgresConnection> connection;
 	string dsn;
@@ -12,6 +12,9 @@
 #include "postgres_utils.hpp"
 #include "postgres_connection.hpp"
 #include "storage/postgres_connection_pool.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 class PostgresCatalog;
@@ -19,6 +22,36 @@ struct PostgresLocalState;
 struct PostgresGlobalState;
 class PostgresTransaction;
 
+//! A remote scan whose result is shared between multiple scans of the same table in a query plan
+struct PostgresSharedScan {
+	//! The columns of the table that are read by any of the scans
+	vector<column_t> column_ids;
+	//! The filters of every scan - empty if the scan has no filters
+	vector<string> filters;
+
+	//! Held while the remote scan is run - so that only the first scan that is initialized runs it
+	mutex lock;
+
+public:
+	//! Returns the column of the shared result that holds whether or not a row passes the filters of a scan
+	optional_idx GetFilterColumn(idx_t scan_idx) const;
+};
+
+//! The results of the shared scans of the running query - the results are dropped once the query finishes, so that
+//! every execution of a (prepared) query reads the tables again
+class PostgresSharedScanState : public ClientContextState {
+public:
+	static shared_ptr<PostgresSharedScanState> Get(ClientContext &context);
+
+	shared_ptr<ColumnDataCollection> GetResult(const PostgresSharedScan &scan);
+	void SetResult(const PostgresSharedScan &scan, shared_ptr<ColumnDataCollection> result);
+	void QueryEnd() override;
+
+private:
+	mutex lock;
+	unordered_map<const PostgresSharedScan *, shared_ptr<ColumnDataCollection>> results;
+};
+
 struct PostgresBindData : public FunctionData {
 	static constexpr const idx_t DEFAULT_PAGES_PER_TASK = 1000;
 
@@ -26,6 +59,13 @@ struct PostgresBindData : public FunctionData {
 	string schema_name;
 	string table_name;
 	string sql;
+	//! The parameters of a parameterized postgres_query (if any)
+	shared_ptr<PostgresQueryParameters> parameters;
+	//! The integer column a partitioned postgres_query is split on - every partition is read as a separate task
+	string partition_column;
+	idx_t partition_count = 0;
+	int64_t partition_lower = 0;
+	int64_t partition_upper = 0;
 	idx_t pages_approx = 0;
 
 	vector<PostgresType> postgres_types;
@@ -39,7 +79,16 @@ struct PostgresBindData : public FunctionData {
 	bool can_use_main_thread = true;
 	bool read_only = true;
 	bool emit_ctid = false;
+	//! Whether or not a scan that requires materialization can instead stream on a separate connection that uses the
+	//! snapshot of the transaction - this is only possible if the transaction has not written anything yet
+	bool can_stream_from_snapshot = false;
 	idx_t max_threads = 1;
+	//! The remote scan this scan shares with other scans of the same table (if any)
+	shared_ptr<PostgresSharedScan> shared_scan;
+	//! The index of this scan within the shared scan
+	idx_t shared_scan_idx = 0;
+	//! Whether or not the scan reads from the local replica of the table
+	bool use_replica = false;
 
 public:
 	void SetTablePages(idx_t approx_num_pages);
@@ -48,6 +97,8 @@ public:
 	optional_ptr<PostgresCatalog> GetCatalog() const {
 		return pg_catalog;
 	}
+	//! The connection pool of the attached database - or the shared connection pool of the dsn of a postgres_scan
+	PostgresConnectionPool &GetConnectionPool() const;
 
 	unique_ptr<FunctionData> Copy() const override {
 		throw NotImplementedException("");
@@ -56,6 +107,9 @@ public:
 		return false;
 	}
 
+	//! The connection pool of a postgres_scan that does not go through an attached database
+	shared_ptr<PostgresConnectionPool> connection_pool;
+
 private:
 	optional_ptr<PostgresCatalog> pg_catalog;
 };
@@ -96,4 +150,14 @@ public:
 	PostgresExecuteFunction();
 };
 
+class PostgresSyncFunction : public TableFunction {
+public:
+	PostgresSyncFunction();
+};
+
+class PostgresExportFunction : public TableFunction {
+public:
+	PostgresExportFunction();
+};
+
 } // namespace duckdb
@@ -50,6 +50,8 @@ struct PostgresCopyState {
 	PostgresCopyFormat format = PostgresCopyFormat::AUTO;
 	bool has_null_byte_replacement = false;
 	string null_byte_replacement;
+	//! The Postgres types of the copied columns, if known
+	vector<PostgresType> column_types;
 
 	void Initialize(ClientContext &context);
 };
@@ -57,6 +59,10 @@ struct PostgresCopyState {
 class PostgresUtils {
 public:
 	static PGconn *PGConnect(const string &dsn);
+	//! Appends options ("key=value key=value") to a connection string - either in the key/value or in the URI format
+	static string AddConnectionOptions(const string &dsn, const string &options);
+	//! Opens multiple connections at once - the connections are established concurrently rather than one by one
+	static vector<PGconn *> PGConnectConcurrently(const string &dsn, idx_t count);
 
 	static LogicalType ToPostgresType(const LogicalType &input);
 	static LogicalType TypeToLogicalType(optional_ptr<PostgresTransaction> transaction,
@@ -66,7 +72,21 @@ public:
 	static string PostgresOidToName(uint32_t oid);
 	static uint32_t ToPostgresOid(const LogicalType &input);
 	static bool SupportedPostgresOid(const LogicalType &input);
+	//! Returns the oid of a (possibly annotated) type as it is stored in Postgres, or false if the oid is unknown
+	static bool TryGetPostgresOid(const LogicalType &input, const PostgresType &postgres_type, uint32_t &result);
+	static uint32_t ToPostgresOid(const LogicalType &input, const PostgresType &postgres_type);
+	//! Whether or not a LIST type is an actual Postgres array (as opposed to e.g. a geometric type)
+	static bool IsPostgresArray(const LogicalType &input, const PostgresType &postgres_type);
+	//! Sets the type oid - and the element oid for arrays - as they were read from the Postgres catalog
+	static void SetPostgresOids(const LogicalType &input, PostgresType &postgres_type, idx_t type_oid,
+	                            idx_t element_oid);
+	//! Removes the aliases of (nested) enum and composite types - the aliases are the names of the Postgres types,
+	//! which do not exist in other databases
 	static LogicalType RemoveAlias(const LogicalType &type);
+	//! Returns the column definitions of a local DuckDB table that holds the given columns - without type aliases
+	static string GetColumnDefinitions(const vector<string> &names, const vector<LogicalType> &types);
+	//! Returns the select list of a COPY that reads the given columns from Postgres
+	static string GetCopyColumnList(const vector<string> &postgres_names, const vector<PostgresType> &postgres_types);
 	static PostgresType CreateEmptyPostgresType(const LogicalType &type);
 
 	static PostgresVersion ExtractPostgresVersion(const string &version);
@@ -13,10 +13,12 @@
 #include "postgres_connection.hpp"
 #include "storage/postgres_schema_set.hpp"
 #include "storage/postgres_connection_pool.hpp"
+#include "storage/postgres_query_cache.hpp"
 
 namespace duckdb {
 class PostgresCatalog;
 class PostgresSchemaEntry;
+class PostgresReplicaCache;
 
 class PostgresCatalog : public Catalog {
 public:
@@ -67,11 +69,22 @@ public:
 	string GetDBPath() override;
 
 	PostgresConnectionPool &GetConnectionPool() {
-		return connection_pool;
+		return *connection_pool;
 	}
 
 	void ClearCache();
 
+	//! The cache of the result schemas of postgres_query
+	PostgresQueryCache &GetQueryCache() {
+		return query_cache;
+	}
+
+	//! The local copy of the tables of this database (if any)
+	optional_ptr<PostgresReplicaCache> GetReplicaCache() {
+		return replica_cache.get();
+	}
+	void SetReplicaCache(unique_ptr<PostgresReplicaCache> replica_cache);
+
 	//! Whether or not this catalog should search a specific type with the standard priority
 	CatalogLookupBehavior CatalogTypeLookupRule(CatalogType type) const override {
 		switch (type) {
@@ -92,8 +105,11 @@ private:
 private:
 	PostgresVersion version;
 	PostgresSchemaSet schemas;
-	PostgresConnectionPool connection_pool;
+	//! The connection pool - shared with all other databases that connect to the same server with the same settings
+	shared_ptr<PostgresConnectionPool> connection_pool;
 	string default_schema;
+	unique_ptr<PostgresReplicaCache> replica_cache;
+	PostgresQueryCache query_cache;
 };
 
 } // namespace duckdb
@@ -9,14 +9,39 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "postgres_connection.hpp"
 
+#include <condition_variable>
+#include <functional>
+#include <thread>
+
 namespace duckdb {
-class PostgresCatalog;
+class DatabaseInstance;
 class PostgresConnectionPool;
 
+struct PostgresPoolOptions {
+	static constexpr const idx_t DEFAULT_IDLE_TIMEOUT = 300;
+
+	//! The amount of idle connections that are opened right after ATTACH and that are never closed for being idle
+	idx_t minimum_connections = 0;
+	//! Idle connections are closed after this many seconds (0 = never)
+	idx_t idle_timeout = DEFAULT_IDLE_TIMEOUT;
+	//! Connections are closed once they have been open for this many seconds (0 = never)
+	idx_t max_lifetime = 0;
+};
+
+//! The pool options that were passed to ATTACH - options that were not passed keep the value of the (shared) pool
+struct PostgresExplicitPoolOptions {
+	optional_idx minimum_connections;
+	optional_idx idle_timeout;
+	optional_idx max_lifetime;
+};
+
 class PostgresPoolConnection {
 public:
 	PostgresPoolConnection();
@@ -41,27 +66,108 @@ class PostgresConnectionPool {
 public:
 	static constexpr const idx_t DEFAULT_MAX_CONNECTIONS = 64;
 
-	PostgresConnectionPool(PostgresCatalog &postgres_catalog, idx_t maximum_connections = DEFAULT_MAX_CONNECTIONS);
+	explicit PostgresConnectionPool(string connection_string, idx_t maximum_connections = DEFAULT_MAX_CONNECTIONS);
+	~PostgresConnectionPool();
 
 public:
 	bool TryGetConnection(PostgresPoolConnection &connection);
-	PostgresPoolConnection GetConnection();
+	//! Waits up to timeout_ms for a connection slot to free up - waiters are handed slots in the order in which they
+	//! started waiting. The wait is abandoned early if should_stop returns true.
+	bool TryGetConnection(PostgresPoolConnection &connection, idx_t timeout_ms,
+	                      const std::function<bool()> &should_stop = nullptr);
+	//! Waits up to timeout_ms for a connection slot - throws if none frees up in time
+	PostgresPoolConnection GetConnection(idx_t timeout_ms = 0);
 	//! Always returns a connection - even if the connection slots are exhausted
 	PostgresPoolConnection ForceGetConnection();
 	void ReturnConnection(PostgresConnection connection);
 	void SetMaximumConnections(idx_t new_max);
+	//! Sets the maximum amount of connections on behalf of a database instance - the pool can be shared across
+	//! instances, so only the instance that first set the limit can change it (until that instance is destroyed)
+	void SetMaximumConnections(DatabaseInstance &instance, idx_t new_max);
+	void SetOptions(PostgresPoolOptions new_options);
+	//! Applies the options that were passed to ATTACH - throws if an option conflicts with the value that an earlier
+	//! ATTACH of the (shared) pool passed
+	void SetExplicitOptions(const PostgresExplicitPoolOptions &new_options);
+	//! Opens connections until (at least) the given amount of idle connections are cached - the connections are
+	//! established concurrently
+	void Prewarm(idx_t connection_count);
+	//! Prewarms the pool in a background thread
+	void PrewarmInBackground(idx_t connection_count);
+	//! Whether or not the pool has neither connections in use nor idle connections
+	bool IsEmpty();
 
 	static void PostgresSetConnectionCache(ClientContext &context, SetScope scope, Value &parameter);
+	//! Returns how long (in milliseconds) to wait for a connection slot when the pool is exhausted
+	static idx_t GetAcquireTimeout(ClientContext &context);
 
 private:
-	PostgresCatalog &postgres_catalog;
+	string connection_string;
 	mutex connection_lock;
 	idx_t active_connections;
 	idx_t maximum_connections;
 	vector<PostgresConnection> connection_cache;
+	PostgresPoolOptions options;
+	//! The options that were passed to ATTACH so far
+	PostgresExplicitPoolOptions explicit_options;
+	//! The database instance that sets the maximum amount of connections (if any)
+	weak_ptr<DatabaseInstance> limit_owner;
+	//! Signaled whenever a connection slot frees up
+	std::condition_variable connection_available;
+	//! The waiters for a connection slot, in the order in which they started waiting
+	deque<idx_t> waiters;
+	idx_t next_waiter_id = 0;
+	std::thread prewarm_thread;
+	//! Connections that were returned in a bad state - these are reset or closed by the maintenance thread so that
+	//! the (blocking) reset never happens while the pool lock is held
+	vector<PostgresConnection> quarantine;
+	std::thread maintenance_thread;
+	std::condition_variable maintenance_signal;
+	bool shutdown = false;
+
+private:
+	//! Takes a connection slot if one is available in this pool and in the process - must be called with the lock held
+	bool TryReserveSlot(bool force = false);
+	//! Gives back a connection slot - must be called with the lock held
+	void ReleaseSlot();
+	//! Takes a cached connection (if any) - must be called with the lock held
+	PostgresConnection TakeCachedConnection();
+	//! Validates the cached connection of a reserved slot, or opens a new connection - called without the lock
+	PostgresPoolConnection FinishConnection(PostgresConnection connection);
+	//! Hands a connection to the maintenance thread - must be called with the lock held
+	void Quarantine(PostgresConnection connection);
+	bool ExceedsMaxLifetime(PostgresConnection &connection, std::chrono::steady_clock::time_point now) const;
+	//! Removes the cached connections that have expired - must be called with the lock held
+	vector<PostgresConnection> EvictExpiredConnections();
+	void StartMaintenance();
+	void RunMaintenance();
+	//! Applies the current options - must be called with the lock held, returns the amount of connections to prewarm
+	idx_t ApplyOptions();
+};
+
+//! The process-wide registry of connection pools - all attached databases and postgres_scan calls that connect to
+//! the same server with the same settings and credentials share a connection pool
+class PostgresConnectionPoolRegistry {
+public:
+	static PostgresConnectionPoolRegistry &Get();
+
+	shared_ptr<PostgresConnectionPool> GetPool(const string &connection_string);
+	//! Sets the maximum amount of connections that are in use across all connection pools (0 = no limit)
+	void SetMaximumConnections(idx_t new_max);
+	bool TryReserveConnection(bool force);
+	void ReleaseConnection();
+
+	static void PostgresSetGlobalConnectionLimit(ClientContext &context, SetScope scope, Value &parameter);
+
+private:
+	//! Returns the key of a connection string - connection strings that only differ in formatting or in the order of
+	//! their options share a key
+	static string NormalizeConnectionString(const string &connection_string);
 
 private:
-	PostgresPoolConnection GetConnectionInternal();
+	mutex lock;
+	unordered_map<string, shared_ptr<PostgresConnectionPool>> pools;
+	atomic<idx_t> active_connections {0};
+	atomic<idx_t> maximum_connections {0};
 };
 
 } // namespace duckdb
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/postgres_dml_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+class PostgresCatalog;
+class LogicalInsert;
+class LogicalUpdate;
+class LogicalDelete;
+
+//! Executes an INSERT, UPDATE or DELETE statement that only references a single Postgres database directly in Postgres
+class PostgresDMLPushdown : public PhysicalOperator {
+public:
+	PostgresDMLPushdown(LogicalOperator &op, TableCatalogEntry &table, string sql);
+
+	//! The table that is modified
+	TableCatalogEntry &table;
+	//! The statement that is executed in Postgres
+	string sql;
+
+public:
+	//! Try to plan an INSERT as a single remote statement - returns nullptr if this is not possible
+	static unique_ptr<PhysicalOperator> TryPlanInsert(ClientContext &context, LogicalInsert &op,
+	                                                  PhysicalOperator &plan);
+	//! Try to plan an UPDATE as a single remote statement - returns nullptr if this is not possible
+	static unique_ptr<PhysicalOperator> TryPlanUpdate(ClientContext &context, LogicalUpdate &op,
+	                                                  PhysicalOperator &plan);
+	//! Try to plan a DELETE as a single remote statement - returns nullptr if this is not possible
+	static unique_ptr<PhysicalOperator> TryPlanDelete(ClientContext &context, LogicalDelete &op,
+	                                                  PhysicalOperator &plan);
+
+public:
+	// Source interface
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+	string GetName() const override;
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+} // namespace duckdb
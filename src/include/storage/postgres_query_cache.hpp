@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/postgres_query_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "postgres_utils.hpp"
+
+namespace duckdb {
+
+//! The result schema of a query run through postgres_query
+struct PostgresQueryDescription {
+	vector<string> names;
+	vector<LogicalType> types;
+	vector<PostgresType> postgres_types;
+};
+
+//! Caches the result schemas of the queries run through postgres_query - so that binding the same query again does
+//! not need to prepare and describe it in Postgres
+//! Like the table entries of the catalog, the cache is cleared by pg_clear_cache and by DDL statements
+class PostgresQueryCache {
+public:
+	static constexpr const idx_t MAX_ENTRIES = 1024;
+
+	//! Returns the cached description of a query, or nullptr if the query is not cached
+	shared_ptr<PostgresQueryDescription> Get(const string &sql);
+	void Insert(const string &sql, shared_ptr<PostgresQueryDescription> description);
+	void Clear();
+
+private:
+	mutex lock;
+	unordered_map<string, shared_ptr<PostgresQueryDescription>> entries;
+};
+
+} // namespace duckdb
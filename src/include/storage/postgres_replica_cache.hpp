@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/postgres_replica_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database.hpp"
+
+namespace duckdb {
+
+//! The state of a Postgres table - used to detect whether or not the local copy of a table is stale
+struct PostgresReplicaVersion {
+	//! The relfilenode of the table - changes on e.g. TRUNCATE, VACUUM FULL or CLUSTER
+	int64_t relfilenode = -1;
+	//! The amount of inserted, updated and deleted tuples according to pg_stat_all_tables
+	int64_t tuples_inserted = 0;
+	int64_t tuples_updated = 0;
+	int64_t tuples_deleted = 0;
+	//! The column names and types of the table
+	string signature;
+
+public:
+	bool operator==(const PostgresReplicaVersion &other) const;
+	//! Whether or not the table has only seen inserts since the other version
+	bool IsAppendOnly(const PostgresReplicaVersion &other) const;
+};
+
+//! The local copy of a Postgres table
+struct PostgresReplicaTable {
+	PostgresReplicaVersion version;
+	//! The name of the table in the local database
+	string local_name;
+	//! The largest value of the append key column (if any)
+	Value last_key;
+};
+
+//! A scan of the local copy of a table - the rows are streamed from the local database
+struct PostgresReplicaScan {
+	unique_ptr<Connection> connection;
+	unique_ptr<QueryResult> result;
+};
+
+//! Keeps local copies of Postgres tables in a DuckDB database file, so that they survive across sessions
+//! Tables are only re-read from Postgres when the statistics of the table indicate that it has changed
+//! Only the metadata of the copies is kept in memory - scans stream the rows from the database file
+class PostgresReplicaCache {
+public:
+	PostgresReplicaCache(const string &path, string append_key, DBConfig &config);
+
+	//! The column used to incrementally refresh tables that have only seen inserts (if any)
+	const string &GetAppendKey() const {
+		return append_key;
+	}
+
+	//! Returns the local copy of a table, or nullptr if there is none
+	shared_ptr<PostgresReplicaTable> GetTable(const string &schema_name, const string &table_name);
+	//! Replaces the local copy of a table
+	shared_ptr<PostgresReplicaTable> StoreTable(const string &schema_name, const string &table_name,
+	                                            PostgresReplicaVersion version, ColumnDataCollection &rows,
+	                                            optional_idx key_column);
+	//! Appends rows that were inserted since the local copy was made
+	shared_ptr<PostgresReplicaTable> AppendTable(const string &schema_name, const string &table_name,
+	                                             PostgresReplicaVersion version, ColumnDataCollection &rows,
+	                                             optional_idx key_column);
+	//! Starts reading the given columns of the local copy of a table
+	unique_ptr<PostgresReplicaScan> ScanTable(const PostgresReplicaTable &table, const vector<column_t> &column_ids);
+	//! Marks the local copy of a table as stale - the next scan re-reads the table from Postgres
+	void InvalidateTable(const string &schema_name, const string &table_name);
+	//! Marks the local copies of all tables as stale
+	void InvalidateTables();
+
+private:
+	shared_ptr<PostgresReplicaTable> LoadTable(const string &schema_name, const string &table_name);
+	string GetLocalName(const string &schema_name, const string &table_name);
+	void WriteTable(const string &local_name, ColumnDataCollection &rows, bool replace);
+	void WriteVersion(const string &schema_name, const string &table_name, const string &local_name,
+	                  const PostgresReplicaVersion &version, Value &last_key, optional_idx key_column);
+	shared_ptr<PostgresReplicaTable> WriteReplica(const string &schema_name, const string &table_name,
+	                                              PostgresReplicaVersion version, ColumnDataCollection &rows,
+	                                              optional_idx key_column, bool replace);
+
+private:
+	mutex lock;
+	DuckDB db;
+	Connection con;
+	string append_key;
+	//! The metadata of the tables that have been loaded from the local database
+	unordered_map<string, shared_ptr<PostgresReplicaTable>> tables;
+};
+
+} // namespace duckdb
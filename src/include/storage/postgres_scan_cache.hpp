@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/postgres_scan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+
+namespace duckdb {
+
+//! Caches the results of scans within a transaction
+//! Transactions run at REPEATABLE READ - as long as the transaction has not written anything, re-running the same scan
+//! returns the same rows
+class PostgresScanCache {
+public:
+	//! Returns the cached result of a scan, or nullptr if the scan is not cached
+	shared_ptr<ColumnDataCollection> Get(const string &key);
+	//! Adds the result of a scan to the cache - evicting the oldest entries if the cache exceeds max_size
+	void Insert(const string &key, shared_ptr<ColumnDataCollection> collection, idx_t max_size);
+	void Clear();
+
+private:
+	mutex lock;
+	//! The cached scan results in insertion order
+	vector<pair<string, shared_ptr<ColumnDataCollection>>> entries;
+	//! The total size of the cached scan results
+	idx_t total_size = 0;
+};
+
+} // namespace duckdb
@@ -44,6 +44,10 @@ public:
 	PostgresTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, PostgresTableInfo &info);
 
 public:
+	//! Look up a table of an attached Postgres database by its qualified name (database.table or
+	//! database.schema.table)
+	static PostgresTableEntry &Lookup(ClientContext &context, const string &function_name, const string &name);
+
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id) override;
 
 	TableFunction GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) override;
@@ -53,8 +57,12 @@ public:
 	void BindUpdateConstraints(Binder &binder, LogicalGet &get, LogicalProjection &proj, LogicalUpdate &update,
 	                           ClientContext &context) override;
 
+	//! Whether or not binary copies are enabled (pg_use_binary_copy)
+	static bool UseBinaryCopy(ClientContext &context);
 	//! Get the copy format (text or binary) that should be used when writing data to this table
 	PostgresCopyFormat GetCopyFormat(ClientContext &context);
+	//! Get the copy format that should be used when writing only the specified columns of this table
+	PostgresCopyFormat GetCopyFormat(ClientContext &context, const vector<PhysicalIndex> &column_indexes);
 
 public:
 	//! Postgres type annotations
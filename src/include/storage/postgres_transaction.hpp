@@ -11,6 +11,7 @@
 #include "duckdb/transaction/transaction.hpp"
 #include "postgres_connection.hpp"
 #include "storage/postgres_connection_pool.hpp"
+#include "storage/postgres_scan_cache.hpp"
 
 namespace duckdb {
 class PostgresCatalog;
@@ -29,6 +30,9 @@ public:
 	void Rollback();
 
 	PostgresConnection &GetConnection();
+	//! Returns the connection for a statement that only reads - in autocommit mode (pg_autocommit_reads) the
+	//! statement runs without starting a Postgres transaction, unless one has already been started
+	PostgresConnection &GetAutocommitConnection();
 	string GetDSN();
 	unique_ptr<PostgresResult> Query(const string &query);
 	vector<unique_ptr<PostgresResult>> ExecuteQueries(const string &queries);
@@ -36,11 +40,28 @@ public:
 
 	string GetTemporarySchema();
 
+	//! Whether or not anything has been written to Postgres in this transaction
+	//! Once data has been written other connections can no longer observe the state of this transaction
+	bool HasWrites();
+	//! Mark that data has been written to Postgres outside of DuckDB's knowledge (e.g. through postgres_execute)
+	void SetHasWrites();
+	//! Returns the cache of scan results of this transaction - the cache is cleared once the transaction writes
+	PostgresScanCache &GetScanCache();
+	//! Mark that a table has been written to - its local replica (if any) is invalidated when the transaction commits
+	void AddWrittenTable(const string &schema_name, const string &table_name);
+
 private:
+	PostgresCatalog &postgres_catalog;
 	PostgresPoolConnection connection;
 	PostgresTransactionState transaction_state;
 	AccessMode access_mode;
 	string temporary_schema;
+	bool has_writes = false;
+	//! Whether or not reads of this (single-statement) transaction can skip BEGIN and COMMIT
+	bool autocommit = false;
+	PostgresScanCache scan_cache;
+	//! The (schema, table) pairs that have been written to in this transaction
+	vector<pair<string, string>> written_tables;
 
 private:
 	//! Retrieves the connection **without** starting a transaction if none is active
@@ -31,12 +31,17 @@ struct PostgresBinaryCopyGlobalState : public GlobalFunctionData {
 
 	void WriteChunk(DataChunk &chunk) {
 		chunk.Flatten();
+		if (copy_state.column_types.empty()) {
+			for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+				copy_state.column_types.push_back(PostgresUtils::CreateEmptyPostgresType(chunk.data[c].GetType()));
+			}
+		}
 		PostgresBinaryWriter writer(copy_state);
 		for (idx_t r = 0; r < chunk.size(); r++) {
 			writer.BeginRow(chunk.ColumnCount());
 			for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
 				auto &col = chunk.data[c];
-				writer.WriteValue(col, r);
+				writer.WriteValue(col, r, copy_state.column_types[c]);
 			}
 			writer.FinishRow();
 		}
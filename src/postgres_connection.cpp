@@ -2,6 +2,7 @@
 #include "duckdb/parser/column_list.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "postgres_connection.hpp"
+#include "postgres_binary_writer.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 #include "duckdb/common/helper.hpp"
@@ -10,7 +11,8 @@ namespace duckdb {
 
 static bool debug_postgres_print_queries = false;
 
-OwnedPostgresConnection::OwnedPostgresConnection(PGconn *conn) : connection(conn) {
+OwnedPostgresConnection::OwnedPostgresConnection(PGconn *conn)
+    : connection(conn), opened_at(std::chrono::steady_clock::now()), idle_since(opened_at) {
 }
 
 OwnedPostgresConnection::~OwnedPostgresConnection() {
@@ -21,6 +23,49 @@ OwnedPostgresConnection::~OwnedPostgresConnection() {
 	connection = nullptr;
 }
 
+PostgresQueryParameters::PostgresQueryParameters(const vector<Value> &parameters) {
+	PostgresCopyState state;
+	for (auto &parameter : parameters) {
+		if (parameter.IsNull()) {
+			types.push_back(0);
+			formats.push_back(0);
+			values.emplace_back();
+			lengths.push_back(0);
+			continue;
+		}
+		auto type = PostgresUtils::ToPostgresType(parameter.type());
+		if (type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::ENUM) {
+			// strings are sent untyped (like string literals) so that they can be compared to e.g. integers, enums or
+			// json - the server infers the type, so the value must be sent in the text format
+			auto str = parameter.ToString();
+			types.push_back(0);
+			formats.push_back(0);
+			lengths.push_back(NumericCast<int>(str.size()));
+			values.push_back(std::move(str));
+			continue;
+		}
+		if (!PostgresUtils::SupportedPostgresOid(type)) {
+			throw NotImplementedException("Parameters of type %s are not supported in postgres_query - cast the "
+			                              "parameter to VARCHAR instead",
+			                              parameter.type().ToString());
+		}
+		types.push_back(PostgresUtils::ToPostgresOid(type));
+		formats.push_back(1);
+		Vector vector(type, 1);
+		vector.SetValue(0, parameter.DefaultCastAs(type));
+		PostgresBinaryWriter writer(state);
+		writer.WriteValue(vector, 0, PostgresUtils::CreateEmptyPostgresType(type));
+		// the writer prefixes the value with its length - strip it
+		auto data = const_char_ptr_cast(writer.stream.GetData()) + sizeof(int32_t);
+		auto size = writer.stream.GetPosition() - sizeof(int32_t);
+		values.emplace_back(data, size);
+		lengths.push_back(NumericCast<int>(size));
+	}
+	for (idx_t i = 0; i < parameters.size(); i++) {
+		value_pointers.push_back(parameters[i].IsNull() ? nullptr : values[i].c_str());
+	}
+}
+
 PostgresConnection::PostgresConnection(shared_ptr<OwnedPostgresConnection> connection_p)
     : connection(std::move(connection_p)) {
 }
@@ -47,6 +92,17 @@ PostgresConnection PostgresConnection::Open(const string &connection_string) {
 	return result;
 }
 
+vector<PostgresConnection> PostgresConnection::OpenConcurrently(const string &connection_string, idx_t count) {
+	vector<PostgresConnection> result;
+	for (auto conn : PostgresUtils::PGConnectConcurrently(connection_string, count)) {
+		PostgresConnection connection;
+		connection.connection = make_shared_ptr<OwnedPostgresConnection>(conn);
+		connection.dsn = connection_string;
+		result.push_back(std::move(connection));
+	}
+	return result;
+}
+
 static bool ResultHasError(PGresult *result) {
 	if (!result) {
 		return true;
@@ -60,11 +116,39 @@ static bool ResultHasError(PGresult *result) {
 	}
 }
 
+void PostgresConnection::QueueStatement(string statement) {
+	GetConnection()->pending_statements.push_back(std::move(statement));
+}
+
+bool PostgresConnection::HasPendingStatements() {
+	return connection && !connection->pending_statements.empty();
+}
+
+void PostgresConnection::DiscardPendingStatements() {
+	if (connection) {
+		connection->pending_statements.clear();
+	}
+}
+
+string PostgresConnection::TakePendingStatements() {
+	string result;
+	if (!connection) {
+		return result;
+	}
+	for (auto &statement : connection->pending_statements) {
+		result += statement;
+		result += ";\n";
+	}
+	connection->pending_statements.clear();
+	return result;
+}
+
 PGresult *PostgresConnection::PQExecute(const string &query) {
+	auto full_query = TakePendingStatements() + query;
 	if (PostgresConnection::DebugPrintQueries()) {
-		Printer::Print(query + "\n");
+		Printer::Print(full_query + "\n");
 	}
-	return PQexec(GetConn(), query.c_str());
+	return PQexec(GetConn(), full_query.c_str());
 }
 
 unique_ptr<PostgresResult> PostgresConnection::TryQuery(const string &query, optional_ptr<string> error_message) {
@@ -92,7 +176,8 @@ void PostgresConnection::Execute(const string &query) {
 	Query(query);
 }
 
-vector<unique_ptr<PostgresResult>> PostgresConnection::ExecuteQueries(const string &queries) {
+vector<unique_ptr<PostgresResult>> PostgresConnection::ExecuteQueries(const string &queries_p) {
+	auto queries = TakePendingStatements() + queries_p;
 	if (PostgresConnection::DebugPrintQueries()) {
 		Printer::Print(queries + "\n");
 	}
@@ -119,7 +204,88 @@ vector<unique_ptr<PostgresResult>> PostgresConnection::ExecuteQueries(const stri
 	return results;
 }
 
+unique_ptr<PostgresResult> PostgresConnection::TryDescribe(const string &query, optional_ptr<string> error_message,
+                                                            optional_ptr<const PostgresQueryParameters> parameters) {
+	auto conn = GetConn();
+	auto pending = std::move(GetConnection()->pending_statements);
+	GetConnection()->pending_statements.clear();
+	if (PostgresConnection::DebugPrintQueries()) {
+		for (auto &statement : pending) {
+			Printer::Print(statement + ";\n");
+		}
+		Printer::Print(query + "\n");
+	}
+	// the extended query protocol does not allow sending multiple statements at once - instead we use pipeline mode
+	// to send the pending statements, the prepare and the describe without waiting for the individual results
+	if (!PQenterPipelineMode(conn)) {
+		throw std::runtime_error("Failed to enter pipeline mode: " + string(PQerrorMessage(conn)));
+	}
+	bool sent = true;
+	for (auto &statement : pending) {
+		sent = sent && PQsendQueryParams(conn, statement.c_str(), 0, nullptr, nullptr, nullptr, nullptr, 0);
+	}
+	auto parameter_count = parameters ? NumericCast<int>(parameters->Count()) : 0;
+	auto parameter_types = parameters ? parameters->types.data() : nullptr;
+	sent = sent && PQsendPrepare(conn, "", query.c_str(), parameter_count, parameter_types);
+	sent = sent && PQsendDescribePrepared(conn, "");
+	sent = sent && PQpipelineSync(conn);
+	if (!sent) {
+		throw std::runtime_error("Failed to send query \"" + query + "\": " + string(PQerrorMessage(conn)));
+	}
+	// every command returns a single result followed by a nullptr - the pipeline ends with a sync result
+	string error;
+	unique_ptr<PostgresResult> description;
+	auto command_count = pending.size() + 2;
+	for (idx_t i = 0; i < command_count; i++) {
+		auto result = make_uniq<PostgresResult>(PQgetResult(conn));
+		auto status = result->res ? PQresultStatus(result->res) : PGRES_FATAL_ERROR;
+		if (status != PGRES_COMMAND_OK && status != PGRES_PIPELINE_ABORTED && error.empty()) {
+			error = StringUtil::Format("Failed to prepare query \"%s\": %s", query,
+			                           result->res ? PQresultErrorMessage(result->res) : PQerrorMessage(conn));
+		}
+		if (i + 1 == command_count) {
+			description = std::move(result);
+		}
+		// consume the nullptr that ends the results of the command
+		PQgetResult(conn);
+	}
+	PostgresResult sync_result(PQgetResult(conn));
+	if (!PQexitPipelineMode(conn) && error.empty()) {
+		error = "Failed to exit pipeline mode: " + string(PQerrorMessage(conn));
+	}
+	if (!error.empty()) {
+		if (error_message) {
+			*error_message = error;
+		}
+		return nullptr;
+	}
+	return description;
+}
+
+void PostgresConnection::SendQueryParams(const string &query, const PostgresQueryParameters &parameters) {
+	auto pending = TakePendingStatements();
+	if (!pending.empty()) {
+		// the extended query protocol does not allow sending multiple statements at once
+		Execute(pending);
+	}
+	if (PostgresConnection::DebugPrintQueries()) {
+		Printer::Print(query + "\n");
+	}
+	auto conn = GetConn();
+	auto sent = PQsendQueryParams(conn, query.c_str(), NumericCast<int>(parameters.Count()), parameters.types.data(),
+	                              parameters.value_pointers.data(), parameters.lengths.data(),
+	                              parameters.formats.data(), 1);
+	if (!sent || !PQsetSingleRowMode(conn)) {
+		throw std::runtime_error("Failed to execute query \"" + query + "\": " + string(PQerrorMessage(conn)));
+	}
+}
+
 PostgresVersion PostgresConnection::GetPostgresVersion() {
+	auto &owned_connection = *GetConnection();
+	if (owned_connection.version) {
+		// pooled connections are reused - do not query the version of the same server over and over again
+		return *owned_connection.version;
+	}
 	auto result = TryQuery("SELECT version(), (SELECT COUNT(*) FROM pg_settings WHERE name LIKE 'rds%')");
 	if (!result) {
 		PostgresVersion version;
@@ -130,6 +296,7 @@ PostgresVersion PostgresConnection::GetPostgresVersion() {
 	if (result->GetInt64(0, 1) > 0) {
 		version.type_v = PostgresInstanceType::AURORA;
 	}
+	owned_connection.version = make_uniq<PostgresVersion>(version);
 	return version;
 }
 
@@ -1,5 +1,6 @@
 #include "postgres_connection.hpp"
 #include "postgres_binary_reader.hpp"
+#include "duckdb/main/appender.hpp"
 
 namespace duckdb {
 
@@ -12,4 +13,38 @@ void PostgresConnection::BeginCopyFrom(PostgresBinaryReader &reader, const strin
 	reader.CheckHeader();
 }
 
+idx_t PostgresConnection::CopyFrom(const string &query, const vector<LogicalType> &types,
+                                   const vector<PostgresType> &postgres_types, BaseAppender &appender) {
+	DataChunk chunk;
+	chunk.Initialize(Allocator::DefaultAllocator(), types);
+	idx_t row_count = 0;
+	PostgresBinaryReader reader(*this);
+	BeginCopyFrom(reader, query);
+	while (true) {
+		if (!reader.Ready() && !reader.Next()) {
+			reader.CheckResult();
+			break;
+		}
+		auto tuple_count = reader.ReadInteger<int16_t>();
+		if (tuple_count <= 0) {
+			// end of the COPY
+			reader.Reset();
+			continue;
+		}
+		for (idx_t c = 0; c < types.size(); c++) {
+			reader.ReadValue(types[c], postgres_types[c], chunk.data[c], chunk.size());
+		}
+		reader.Reset();
+		chunk.SetCardinality(chunk.size() + 1);
+		if (chunk.size() == STANDARD_VECTOR_SIZE) {
+			appender.AppendDataChunk(chunk);
+			row_count += chunk.size();
+			chunk.Reset();
+		}
+	}
+	appender.AppendDataChunk(chunk);
+	row_count += chunk.size();
+	return row_count;
+}
+
 } // namespace duckdb
@@ -110,22 +110,22 @@ void PostgresConnection::FinishCopyTo(PostgresCopyState &state) {
 	}
 }
 
-bool NeedsQuotes(const string &to_quote, idx_t size) {
+static bool NeedsQuotes(const char *data, idx_t size) {
 	// Check if the string contains list or struct specific characters, or if it's empty or starts/ends with whitespaces
-	if (size <= 0) {
+	if (size == 0) {
 		// Always quote the empty string
 		return true;
 	}
-	if (isspace(to_quote[0])) {
+	if (isspace(data[0])) {
 		// The string starts with whitespace, we need to preserve it
 		return true;
 	}
-	if (isspace(to_quote[size - 1])) {
+	if (isspace(data[size - 1])) {
 		// The string ends with whitespace, we need to preserve it
 		return true;
 	}
 	for (idx_t c = 0; c < size; c++) {
-		switch (to_quote[c]) {
+		switch (data[c]) {
 		case '"':
 		case '\\':
 		case '{':
@@ -139,27 +139,37 @@ bool NeedsQuotes(const string &to_quote, idx_t size) {
 	return false;
 }
 
-void EscapeQuotes(const string &to_escape, string &result, idx_t size) {
-	// Escape quotes and backslashes so that the string can be quoted
+//! Returns the size of the string after quoting and escaping it (if required)
+//! The result is equal to "size" if and only if the string does not need to be quoted
+static idx_t QuotedSize(const char *data, idx_t size) {
+	if (!NeedsQuotes(data, size)) {
+		return size;
+	}
+	// two quotes, plus one backslash for every quote or backslash that needs to be escaped
+	idx_t result = size + 2;
 	for (idx_t c = 0; c < size; c++) {
-		switch (to_escape[c]) {
-		case '"':
-		case '\\':
-			result += "\\";
+		if (data[c] == '"' || data[c] == '\\') {
+			result++;
 		}
-		result += to_escape[c];
 	}
+	return result;
 }
 
-void QuoteAndEscapeIfNeeded(const string &to_quote, string &result, idx_t size) {
-	// Quote the string iff it contains list or struct specific characters
-	if (!NeedsQuotes(to_quote, size)) {
-		result += to_quote;
-		return;
+//! Writes a string to the target buffer, quoting and escaping it if quoted_size indicates this is required
+static char *WriteQuoted(const char *data, idx_t size, idx_t quoted_size, char *target) {
+	if (quoted_size == size) {
+		memcpy(target, data, size);
+		return target + size;
 	}
-	result += '"';
-	EscapeQuotes(to_quote, result, size);
-	result += '"';
+	*target++ = '"';
+	for (idx_t c = 0; c < size; c++) {
+		if (data[c] == '"' || data[c] == '\\') {
+			*target++ = '\\';
+		}
+		*target++ = data[c];
+	}
+	*target++ = '"';
+	return target;
 }
 
 void CastToPostgresVarchar(ClientContext &context, Vector &input, Vector &result, idx_t size);
@@ -172,8 +182,20 @@ void CastListToPostgresArray(ClientContext &context, Vector &input, Vector &varc
 	Vector child_varchar(LogicalType::VARCHAR, child_count);
 	CastToPostgresVarchar(context, child_data, child_varchar, child_count);
 
-	// construct the list entries
+	// compute the (quoted) size of every child entry
 	auto child_entries = FlatVector::GetData<string_t>(child_varchar);
+	auto &child_validity = FlatVector::Validity(child_varchar);
+	auto child_sizes = unique_ptr<idx_t[]>(new idx_t[MaxValue<idx_t>(child_count, 1)]);
+	for (idx_t child_idx = 0; child_idx < child_count; child_idx++) {
+		if (!child_validity.RowIsValid(child_idx)) {
+			child_sizes[child_idx] = 4; // NULL
+			continue;
+		}
+		auto &child = child_entries[child_idx];
+		child_sizes[child_idx] = skip_quoting ? child.GetSize() : QuotedSize(child.GetData(), child.GetSize());
+	}
+
+	// construct the list entries directly in the string heap of the result vector
 	auto list_entries = FlatVector::GetData<list_entry_t>(input);
 	auto result_entries = FlatVector::GetData<string_t>(varchar_vector);
 	for (idx_t r = 0; r < size; r++) {
@@ -182,26 +204,31 @@ void CastListToPostgresArray(ClientContext &context, Vector &input, Vector &varc
 			continue;
 		}
 		auto list_entry = list_entries[r];
-		string result;
-		result = "{";
+		// "{" + "}" + separators
+		idx_t result_size = 2 + (list_entry.length > 0 ? list_entry.length - 1 : 0);
+		for (idx_t list_idx = 0; list_idx < list_entry.length; list_idx++) {
+			result_size += child_sizes[list_entry.offset + list_idx];
+		}
+		auto result = StringVector::EmptyString(varchar_vector, result_size);
+		auto target = result.GetDataWriteable();
+		*target++ = '{';
 		for (idx_t list_idx = 0; list_idx < list_entry.length; list_idx++) {
 			if (list_idx > 0) {
-				result += ",";
+				*target++ = ',';
 			}
 			auto child_idx = list_entry.offset + list_idx;
-			if (FlatVector::IsNull(child_varchar, child_idx)) {
-				result += "NULL";
+			if (!child_validity.RowIsValid(child_idx)) {
+				memcpy(target, "NULL", 4);
+				target += 4;
 			} else {
-				auto child = child_entries[child_idx];
-				if (skip_quoting) {
-					result += child.GetString();
-				} else {
-					QuoteAndEscapeIfNeeded(child.GetString(), result, child.GetSize());
-				}
+				auto &child = child_entries[child_idx];
+				target = WriteQuoted(child.GetData(), child.GetSize(), child_sizes[child_idx], target);
 			}
 		}
-		result += "}";
-		result_entries[r] = StringVector::AddString(varchar_vector, result);
+		*target++ = '}';
+		D_ASSERT(idx_t(target - result.GetDataWriteable()) == result_size);
+		result.Finalize();
+		result_entries[r] = result;
 	}
 }
 
@@ -214,29 +241,74 @@ void CastStructToPostgres(ClientContext &context, Vector &input, Vector &varchar
 		CastToPostgresVarchar(context, *child_vectors[c], child_varchar, size);
 		child_varchar_vectors.push_back(std::move(child_varchar));
 	}
+	auto child_count = child_varchar_vectors.size();
 
-	// construct the struct entries
+	// construct the struct entries directly in the string heap of the result vector
+	auto child_sizes = unique_ptr<idx_t[]>(new idx_t[MaxValue<idx_t>(child_count, 1)]);
 	auto result_entries = FlatVector::GetData<string_t>(varchar_vector);
 	for (idx_t r = 0; r < size; r++) {
 		if (FlatVector::IsNull(input, r)) {
 			FlatVector::SetNull(varchar_vector, r, true);
 			continue;
 		}
-		string result;
-		result = "(";
-		for (idx_t c = 0; c < child_varchar_vectors.size(); c++) {
+		// "(" + ")" + separators
+		idx_t result_size = 2 + (child_count > 0 ? child_count - 1 : 0);
+		for (idx_t c = 0; c < child_count; c++) {
+			auto &child_vector = child_varchar_vectors[c];
+			if (FlatVector::IsNull(child_vector, r)) {
+				// Struct literals encode null by omitting the value
+				child_sizes[c] = 0;
+				continue;
+			}
+			auto &child = FlatVector::GetData<string_t>(child_vector)[r];
+			child_sizes[c] = QuotedSize(child.GetData(), child.GetSize());
+			result_size += child_sizes[c];
+		}
+		auto result = StringVector::EmptyString(varchar_vector, result_size);
+		auto target = result.GetDataWriteable();
+		*target++ = '(';
+		for (idx_t c = 0; c < child_count; c++) {
 			if (c > 0) {
-				result += ",";
+				*target++ = ',';
 			}
-			if (FlatVector::IsNull(child_varchar_vectors[c], r)) {
-				result += ""; // Struct literals encode null by omitting the value
-			} else {
-				auto child = FlatVector::GetData<string_t>(child_varchar_vectors[c])[r];
-				QuoteAndEscapeIfNeeded(child.GetString(), result, child.GetSize());
+			auto &child_vector = child_varchar_vectors[c];
+			if (FlatVector::IsNull(child_vector, r)) {
+				continue;
 			}
+			auto &child = FlatVector::GetData<string_t>(child_vector)[r];
+			target = WriteQuoted(child.GetData(), child.GetSize(), child_sizes[c], target);
 		}
-		result += ")";
-		result_entries[r] = StringVector::AddString(varchar_vector, result);
+		*target++ = ')';
+		D_ASSERT(idx_t(target - result.GetDataWriteable()) == result_size);
+		result.Finalize();
+		result_entries[r] = result;
+	}
+}
+
+//! Lookup table that maps every byte to its two-character (upper-case) hex representation
+struct PostgresHexTable {
+	PostgresHexTable() {
+		const char *HEX_STRING = "0123456789ABCDEF";
+		for (idx_t i = 0; i < 256; i++) {
+			table[i * 2] = HEX_STRING[i / 16];
+			table[i * 2 + 1] = HEX_STRING[i % 16];
+		}
+	}
+
+	char table[512];
+};
+
+static void HexEncode(const_data_ptr_t source, idx_t size, char *target) {
+	static const PostgresHexTable HEX_TABLE;
+	// encode eight bytes per iteration so the compiler can unroll and vectorize the loop
+	idx_t c = 0;
+	for (; c + 8 <= size; c += 8) {
+		for (idx_t i = 0; i < 8; i++) {
+			memcpy(target + (c + i) * 2, HEX_TABLE.table + source[c + i] * 2, 2);
+		}
+	}
+	for (; c < size; c++) {
+		memcpy(target + c * 2, HEX_TABLE.table + source[c] * 2, 2);
 	}
 }
 
@@ -248,15 +320,16 @@ void CastBlobToPostgres(ClientContext &context, Vector &input, Vector &result, i
 			FlatVector::SetNull(result, r, true);
 			continue;
 		}
-		const char *HEX_STRING = "0123456789ABCDEF";
-		string blob_str = "\\x";
 		auto blob_data = const_data_ptr_cast(input_data[r].GetData());
 		auto blob_size = input_data[r].GetSize();
-		for (idx_t c = 0; c < blob_size; c++) {
-			blob_str += HEX_STRING[blob_data[c] / 16];
-			blob_str += HEX_STRING[blob_data[c] % 16];
-		}
-		result_data[r] = StringVector::AddString(result, blob_str);
+		// "\x" followed by two hex characters per byte
+		auto blob_str = StringVector::EmptyString(result, 2 + blob_size * 2);
+		auto target = blob_str.GetDataWriteable();
+		target[0] = '\\';
+		target[1] = 'x';
+		HexEncode(blob_data, blob_size, target + 2);
+		blob_str.Finalize();
+		result_data[r] = blob_str;
 	}
 }
 
@@ -282,12 +355,19 @@ void PostgresConnection::CopyChunk(ClientContext &context, PostgresCopyState &st
 	chunk.Flatten();
 
 	if (state.format == PostgresCopyFormat::BINARY) {
+		if (state.column_types.empty()) {
+			// no Postgres types were provided - derive them from the DuckDB types
+			for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+				state.column_types.push_back(PostgresUtils::CreateEmptyPostgresType(chunk.data[c].GetType()));
+			}
+		}
+		D_ASSERT(state.column_types.size() == chunk.ColumnCount());
 		PostgresBinaryWriter writer(state);
 		for (idx_t r = 0; r < chunk.size(); r++) {
 			writer.BeginRow(chunk.ColumnCount());
 			for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
 				auto &col = chunk.data[c];
-				writer.WriteValue(col, r);
+				writer.WriteValue(col, r, state.column_types[c]);
 			}
 			writer.FinishRow();
 		}
@@ -46,6 +46,10 @@ static void PGExecuteFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 	auto &transaction = Transaction::Get(context, data.pg_catalog).Cast<PostgresTransaction>();
 	transaction.Query(data.query);
+	// the query can modify anything - scans can no longer use other connections in this transaction
+	transaction.SetHasWrites();
+	// and the query might have changed the result schema of cached queries
+	data.pg_catalog.GetQueryCache().Clear();
 	data.finished = true;
 }
 
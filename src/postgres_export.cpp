@@ -0,0 +1,292 @@
+#include "duckdb.hpp"
+
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/main/appender.hpp"
+#include "duckdb/main/connection.hpp"
+#include "postgres_scanner.hpp"
+#include "storage/postgres_catalog.hpp"
+#include "storage/postgres_table_entry.hpp"
+
+#include <thread>
+
+namespace duckdb {
+
+struct PostgresExportBindData : public TableFunctionData {
+	string dsn;
+	PostgresVersion version;
+	string schema_name;
+	string table_name;
+	vector<string> postgres_names;
+	vector<PostgresType> postgres_types;
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The directory the table is exported to - every task is written to a separate file
+	string path;
+	string format;
+	//! The file that records which tasks have been exported
+	string checkpoint_path;
+	idx_t pages_per_task = PostgresBindData::DEFAULT_PAGES_PER_TASK;
+	bool finished = false;
+
+	string GetTableName() const {
+		return KeywordHelper::WriteQuoted(schema_name, '"') + "." + KeywordHelper::WriteQuoted(table_name, '"');
+	}
+};
+
+struct PostgresExportState {
+	PostgresExportState(PostgresExportBindData &data, DatabaseInstance &db, FileSystem &fs)
+	    : data(data), db(db), fs(fs) {
+	}
+
+	PostgresExportBindData &data;
+	DatabaseInstance &db;
+	FileSystem &fs;
+	idx_t task_count = 0;
+	//! The snapshot all tasks of this export read from
+	string snapshot;
+
+	mutex lock;
+	//! The tasks that still need to be exported
+	vector<idx_t> remaining_tasks;
+	idx_t next_task = 0;
+	unique_ptr<FileHandle> checkpoint;
+	idx_t exported_rows = 0;
+	bool has_error = false;
+	ErrorData error;
+
+public:
+	string GetTaskPath(idx_t task_idx) const {
+		return fs.JoinPath(data.path, StringUtil::Format("part_%d.%s", task_idx, data.format));
+	}
+	bool GetNextTask(idx_t &task_idx);
+	void CompleteTask(idx_t task_idx, idx_t row_count);
+	void SetError(ErrorData new_error);
+};
+
+bool PostgresExportState::GetNextTask(idx_t &task_idx) {
+	lock_guard<mutex> guard(lock);
+	if (has_error || next_task >= remaining_tasks.size()) {
+		return false;
+	}
+	task_idx = remaining_tasks[next_task++];
+	return true;
+}
+
+void PostgresExportState::CompleteTask(idx_t task_idx, idx_t row_count) {
+	lock_guard<mutex> guard(lock);
+	// the task is only recorded once its file has been fully written
+	// every entry is terminated by a semicolon so a partially written entry is never mistaken for a task
+	auto line = to_string(task_idx) + ";\n";
+	checkpoint->Write((void *)line.c_str(), line.size());
+	checkpoint->Sync();
+	exported_rows += row_count;
+}
+
+void PostgresExportState::SetError(ErrorData new_error) {
+	lock_guard<mutex> guard(lock);
+	if (!has_error) {
+		has_error = true;
+		error = std::move(new_error);
+	}
+}
+
+static unique_ptr<FunctionData> PostgresExportBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_uniq<PostgresExportBindData>();
+	auto &table = PostgresTableEntry::Lookup(context, "postgres_export", input.inputs[0].GetValue<string>());
+	auto &pg_catalog = table.catalog.Cast<PostgresCatalog>();
+	result->dsn = pg_catalog.path;
+	result->version = pg_catalog.GetPostgresVersion();
+	result->schema_name = table.schema.name;
+	result->table_name = table.name;
+	result->postgres_names = table.postgres_names;
+	result->postgres_types = table.postgres_types;
+	for (auto &col : table.GetColumns().Logical()) {
+		result->names.push_back(col.GetName());
+		// composite types and enums are aliased with the name of the Postgres type - which does not exist locally
+		result->types.push_back(PostgresUtils::RemoveAlias(col.GetType()));
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	result->path = input.inputs[1].GetValue<string>();
+	result->format = "parquet";
+	result->checkpoint_path = fs.JoinPath(result->path, "postgres_export.checkpoint");
+	for (auto &kv : input.named_parameters) {
+		if (kv.first == "format") {
+			result->format = StringUtil::Lower(kv.second.GetValue<string>());
+		} else if (kv.first == "checkpoint") {
+			result->checkpoint_path = kv.second.GetValue<string>();
+		}
+	}
+	Value pages_per_task;
+	if (context.TryGetCurrentSetting("pg_pages_per_task", pages_per_task) && UBigIntValue::Get(pages_per_task) > 0) {
+		result->pages_per_task = UBigIntValue::Get(pages_per_task);
+	}
+
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("exported_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("skipped_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("exported_rows");
+	return std::move(result);
+}
+
+static void CheckResult(QueryResult &result) {
+	if (result.HasError()) {
+		result.ThrowError("Failed to export Postgres table: ");
+	}
+}
+
+//! The checkpoint header identifies the export - a checkpoint can only be resumed if the physical table (and with it
+//! the meaning of every CTID range), the task layout and the output format have not changed
+static string GetCheckpointHeader(PostgresExportBindData &data, int64_t relfilenode, idx_t task_count) {
+	return StringUtil::Format("postgres_export\t%d\t%d\t%d\t%s\t%s\t%s\n", relfilenode, task_count,
+	                          data.pages_per_task, data.format, data.GetTableName(),
+	                          StringUtil::Join(data.postgres_names, ","));
+}
+
+//! Opens the checkpoint file - either resuming an earlier export or starting a new one
+static void OpenCheckpoint(PostgresExportState &state, int64_t relfilenode, idx_t relpages) {
+	auto &data = state.data;
+	auto &fs = state.fs;
+	unordered_set<idx_t> completed_tasks;
+	if (fs.FileExists(data.checkpoint_path)) {
+		auto handle = fs.OpenFile(data.checkpoint_path, FileFlags::FILE_FLAGS_READ);
+		auto file_size = NumericCast<idx_t>(handle->GetFileSize());
+		string contents(file_size, '\0');
+		handle->Read((void *)contents.data(), file_size);
+		auto lines = StringUtil::Split(contents, '\n');
+		auto header = lines.empty() ? vector<string>() : StringUtil::Split(lines[0], '\t');
+		if (header.size() < 3 || header[0] != "postgres_export") {
+			throw IOException("File \"%s\" is not a postgres_export checkpoint", data.checkpoint_path);
+		}
+		state.task_count = std::stoull(header[2]);
+		if (lines[0] + "\n" != GetCheckpointHeader(data, relfilenode, state.task_count)) {
+			throw IOException("Checkpoint \"%s\" belongs to a different export, or the table has been rewritten "
+			                  "since - remove the checkpoint to restart the export",
+			                  data.checkpoint_path);
+		}
+		for (idx_t i = 1; i < lines.size(); i++) {
+			if (StringUtil::EndsWith(lines[i], ";")) {
+				completed_tasks.insert(std::stoull(lines[i]));
+			}
+		}
+		state.checkpoint =
+		    fs.OpenFile(data.checkpoint_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_APPEND);
+		if (!StringUtil::EndsWith(contents, "\n")) {
+			// terminate the entry that was being written when the previous export failed
+			state.checkpoint->Write((void *)"\n", 1);
+		}
+	} else {
+		if (!fs.DirectoryExists(data.path)) {
+			fs.CreateDirectory(data.path);
+		}
+		// the last task reads everything past the end of the table, so the task layout is fixed on the first run
+		state.task_count = MaxValue<idx_t>((relpages + data.pages_per_task - 1) / data.pages_per_task, 1);
+		auto header = GetCheckpointHeader(data, relfilenode, state.task_count);
+		state.checkpoint = fs.OpenFile(data.checkpoint_path, FileFlags::FILE_FLAGS_WRITE |
+		                                                         FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		state.checkpoint->Write((void *)header.c_str(), header.size());
+		state.checkpoint->Sync();
+	}
+	for (idx_t task_idx = 0; task_idx < state.task_count; task_idx++) {
+		if (completed_tasks.find(task_idx) == completed_tasks.end()) {
+			state.remaining_tasks.push_back(task_idx);
+		}
+	}
+}
+
+static void PostgresExportWorker(PostgresExportState &state) {
+	auto &data = state.data;
+	try {
+		Connection con(state.db);
+		auto pg_con = PostgresConnection::Open(data.dsn);
+		if (!state.snapshot.empty()) {
+			pg_con.Execute("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY");
+			pg_con.Query(StringUtil::Format("SET TRANSACTION SNAPSHOT '%s'", state.snapshot));
+		}
+		auto columns = PostgresUtils::GetColumnDefinitions(data.names, data.types);
+		auto col_names = PostgresUtils::GetCopyColumnList(data.postgres_names, data.postgres_types);
+		// every task is staged in a temporary table and then written to its own file
+		CheckResult(*con.Query("CREATE OR REPLACE TEMPORARY TABLE __postgres_export(" + columns + ")"));
+		idx_t task_idx;
+		while (state.GetNextTask(task_idx)) {
+			auto page_min = task_idx * data.pages_per_task;
+			auto page_max = task_idx + 1 == state.task_count ? NumericLimits<uint32_t>::Maximum()
+			                                                 : page_min + data.pages_per_task;
+			auto query = StringUtil::Format(
+			    "COPY (SELECT %s FROM %s WHERE ctid BETWEEN '(%d,0)'::tid AND '(%d,0)'::tid) TO STDOUT (FORMAT binary)",
+			    col_names, data.GetTableName(), page_min, page_max);
+			idx_t row_count;
+			{
+				Appender appender(con, "__postgres_export");
+				row_count = pg_con.CopyFrom(query, data.types, data.postgres_types, appender);
+				appender.Close();
+			}
+			CheckResult(*con.Query(StringUtil::Format("COPY __postgres_export TO %s (FORMAT %s)",
+			                                          KeywordHelper::WriteQuoted(state.GetTaskPath(task_idx), '\''),
+			                                          data.format)));
+			CheckResult(*con.Query("DELETE FROM __postgres_export"));
+			state.CompleteTask(task_idx, row_count);
+		}
+	} catch (std::exception &ex) {
+		state.SetError(ErrorData(ex));
+	}
+}
+
+static void PGExportFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<PostgresExportBindData>();
+	if (data.finished) {
+		return;
+	}
+	data.finished = true;
+
+	PostgresExportState state(data, *context.db, FileSystem::GetFileSystem(context));
+	auto pg_con = PostgresConnection::Open(data.dsn);
+	auto table_info = pg_con.Query(StringUtil::Format("SELECT relkind, relfilenode, relpages FROM pg_class WHERE oid = "
+	                                                  "%s::regclass",
+	                                                  KeywordHelper::WriteQuoted(data.GetTableName(), '\'')));
+	auto relkind = table_info->GetString(0, 0);
+	if (relkind != "r" && relkind != "m") {
+		throw BinderException("postgres_export can only export tables and materialized views");
+	}
+	OpenCheckpoint(state, table_info->GetInt64(0, 1), NumericCast<idx_t>(table_info->GetInt64(0, 2)));
+	auto skipped_tasks = state.task_count - state.remaining_tasks.size();
+
+	// the tasks of a single run all read from the same snapshot
+	// tasks completed by an earlier run were read from an earlier snapshot
+	if (state.remaining_tasks.size() > 1 && data.version >= PostgresVersion(9, 2, 0)) {
+		pg_con.Execute("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY");
+		state.snapshot = pg_con.Query("SELECT pg_export_snapshot()")->GetString(0, 0);
+	}
+	auto thread_count = MinValue<idx_t>(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads()),
+	                                    state.remaining_tasks.size());
+	if (state.snapshot.empty()) {
+		thread_count = MinValue<idx_t>(thread_count, 1);
+	}
+	vector<std::thread> threads;
+	for (idx_t i = 0; i < thread_count; i++) {
+		threads.emplace_back(PostgresExportWorker, std::ref(state));
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	if (state.has_error) {
+		state.error.Throw();
+	}
+	output.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(state.remaining_tasks.size())));
+	output.SetValue(1, 0, Value::BIGINT(NumericCast<int64_t>(skipped_tasks)));
+	output.SetValue(2, 0, Value::BIGINT(NumericCast<int64_t>(state.exported_rows)));
+	output.SetCardinality(1);
+}
+
+PostgresExportFunction::PostgresExportFunction()
+    : TableFunction("postgres_export", {LogicalType::VARCHAR, LogicalType::VARCHAR}, PGExportFunction,
+                    PostgresExportBind) {
+	named_parameters["format"] = LogicalType::VARCHAR;
+	named_parameters["checkpoint"] = LogicalType::VARCHAR;
+}
+
+} // namespace duckdb
@@ -63,7 +63,8 @@ static void SetPostgresConnectionLimit(ClientContext &context, SetScope scope, V
 		if (catalog.GetCatalogType() != "postgres") {
 			continue;
 		}
-		catalog.Cast<PostgresCatalog>().GetConnectionPool().SetMaximumConnections(UBigIntValue::Get(parameter));
+		auto &pool = catalog.Cast<PostgresCatalog>().GetConnectionPool();
+		pool.SetMaximumConnections(DatabaseInstance::GetDatabase(context), UBigIntValue::Get(parameter));
 	}
 	auto &config = DBConfig::GetConfig(context);
 	config.SetOption("pg_connection_limit", parameter);
@@ -122,6 +123,14 @@ void SetPostgresNullByteReplacement(ClientContext &context, SetScope scope, Valu
 	}
 }
 
+static void SetPostgresMemorySize(ClientContext &context, SetScope scope, Value &parameter) {
+	if (parameter.IsNull()) {
+		return;
+	}
+	// verify that the size can be parsed
+	DBConfig::ParseMemoryLimit(StringValue::Get(parameter));
+}
+
 static void LoadInternal(DatabaseInstance &db) {
 	PostgresScanFunction postgres_fun;
 	ExtensionUtil::RegisterFunction(db, postgres_fun);
@@ -141,6 +150,12 @@ static void LoadInternal(DatabaseInstance &db) {
 	PostgresExecuteFunction execute_func;
 	ExtensionUtil::RegisterFunction(db, execute_func);
 
+	PostgresSyncFunction sync_func;
+	ExtensionUtil::RegisterFunction(db, sync_func);
+
+	PostgresExportFunction export_func;
+	ExtensionUtil::RegisterFunction(db, export_func);
+
 	PostgresBinaryCopyFunction binary_copy;
 	ExtensionUtil::RegisterFunction(db, binary_copy);
 
@@ -168,6 +183,11 @@ static void LoadInternal(DatabaseInstance &db) {
 	config.AddExtensionOption("pg_connection_limit", "The maximum amount of concurrent Postgres connections",
 	                          LogicalType::UBIGINT, Value::UBIGINT(PostgresConnectionPool::DEFAULT_MAX_CONNECTIONS),
 	                          SetPostgresConnectionLimit);
+	config.AddExtensionOption("pg_global_connection_limit",
+	                          "The maximum amount of concurrent Postgres connections across all attached databases and "
+	                          "postgres_scan calls in the process (0 = no limit)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0),
+	                          PostgresConnectionPoolRegistry::PostgresSetGlobalConnectionLimit);
 	config.AddExtensionOption(
 	    "pg_array_as_varchar", "Read Postgres arrays as varchar - enables reading mixed dimensional arrays",
 	    LogicalType::BOOLEAN, Value::BOOLEAN(false), PostgresClearCacheFunction::ClearCacheOnSetting);
@@ -179,6 +199,42 @@ static void LoadInternal(DatabaseInstance &db) {
 	config.AddExtensionOption("pg_null_byte_replacement",
 	                          "When writing NULL bytes to Postgres, replace them with the given character",
 	                          LogicalType::VARCHAR, Value(), SetPostgresNullByteReplacement);
+	config.AddExtensionOption("pg_max_materialization_size",
+	                          "The maximum size of a Postgres scan that is materialized before it is consumed, e.g. "
+	                          "'4GB' (NULL = no limit besides the memory limit)",
+	                          LogicalType::VARCHAR, Value(), SetPostgresMemorySize);
+	config.AddExtensionOption("pg_scan_cache_size",
+	                          "The maximum size of the scan results that are cached within a transaction, e.g. '1GB' - "
+	                          "repeated scans return the cached result until the transaction writes (NULL = disabled)",
+	                          LogicalType::VARCHAR, Value(), SetPostgresMemorySize);
+	config.AddExtensionOption("pg_dml_pushdown",
+	                          "Whether or not to execute INSERT, UPDATE and DELETE statements that only reference a "
+	                          "single Postgres database directly in Postgres",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("pg_share_duplicate_scans",
+	                          "Whether or not to read a table only once when it is scanned multiple times in the same "
+	                          "query - the shared scan is materialized on a single thread",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("pg_update_batch_size",
+	                          "The maximum amount of rows updated per UPDATE statement when applying an update to "
+	                          "Postgres (0 = apply the update in a single statement)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("pg_pool_acquire_timeout",
+	                          "How long (in milliseconds) to wait for a connection when the connection pool is "
+	                          "exhausted - connections are handed out in the order in which they were requested",
+	                          LogicalType::UBIGINT, Value::UBIGINT(5000));
+	config.AddExtensionOption("pg_scan_task_retries",
+	                          "The maximum amount of times a parallel scan task is retried on a new connection after "
+	                          "its connection is lost (0 = disabled)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(3));
+	config.AddExtensionOption("pg_autocommit_reads",
+	                          "Whether or not auto-commit statements that only read from Postgres skip BEGIN and "
+	                          "COMMIT - every read then runs in its own Postgres transaction",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("pg_parallel_decode",
+	                          "Whether or not the rows of a scan that reads through a single connection are decoded by "
+	                          "multiple threads",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
 	config.AddExtensionOption("pg_debug_show_queries", "DEBUG SETTING: print all queries sent to Postgres to stdout",
 	                          LogicalType::BOOLEAN, Value::BOOLEAN(false), SetPostgresDebugQueryPrint);
 
@@ -51,6 +51,10 @@ string PostgresFilterPushdown::TransformFilter(string &column_name, TableFilter
 		auto &constant_filter = (ConstantFilter &)filter;
 		auto constant_string = KeywordHelper::WriteQuoted(constant_filter.constant.ToString());
 		auto operator_string = TransformComparision(constant_filter.comparison_type);
+		if (constant_filter.constant.type().id() == LogicalTypeId::VARCHAR) {
+			// DuckDB compares strings byte-wise - make sure Postgres does not use a linguistic collation
+			return StringUtil::Format("%s COLLATE \"C\" %s %s", column_name, operator_string, constant_string);
+		}
 		return StringUtil::Format("%s %s %s", column_name, operator_string, constant_string);
 	}
 	case TableFilterType::STRUCT_EXTRACT: {
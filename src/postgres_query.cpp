@@ -6,9 +6,110 @@
 #include "duckdb/main/attached_database.hpp"
 #include "storage/postgres_catalog.hpp"
 #include "storage/postgres_transaction.hpp"
+#include "duckdb/common/types/hugeint.hpp"
 
 namespace duckdb {
 
+static shared_ptr<PostgresQueryDescription> PGDescribeQuery(PostgresTransaction &transaction, const string &sql,
+                                                            optional_ptr<const PostgresQueryParameters> parameters) {
+	auto &con = transaction.GetAutocommitConnection();
+	// prepare execution of the query to figure out the result types and names
+	string error;
+	auto prepared = con.TryDescribe(sql, &error, parameters);
+	if (!prepared) {
+		throw BinderException(error);
+	}
+	auto describe_prepared = prepared->res;
+	auto nfields = PQnfields(describe_prepared);
+	if (nfields <= 0) {
+		throw BinderException("No fields returned by query \"%s\" - the query must be a SELECT statement that returns "
+		                      "at least one column",
+		                      sql);
+	}
+	auto description = make_shared_ptr<PostgresQueryDescription>();
+	for (idx_t c = 0; c < nfields; c++) {
+		PostgresType postgres_type;
+		postgres_type.oid = PQftype(describe_prepared, c);
+		PostgresTypeData type_data;
+		type_data.type_name = PostgresUtils::PostgresOidToName(postgres_type.oid);
+		type_data.type_modifier = PQfmod(describe_prepared, c);
+		auto converted_type = PostgresUtils::TypeToLogicalType(nullptr, nullptr, type_data, postgres_type);
+		description->postgres_types.push_back(postgres_type);
+		description->types.emplace_back(converted_type);
+		description->names.emplace_back(PQfname(describe_prepared, c));
+	}
+	return description;
+}
+
+//! Splits the query into partitions on an integer column of its result - the partitions are read as separate tasks
+//! that run in parallel on connections that share the snapshot of the transaction
+static void PGPartitionQuery(PostgresTransaction &transaction, PostgresBindData &bind_data, const string &column,
+                             idx_t partitions, Value lower, Value upper) {
+	if (column.empty() || partitions == 0) {
+		throw BinderException("Partitioning postgres_query requires both \"partition_column\" and \"partitions\"");
+	}
+	optional_idx column_idx;
+	for (idx_t c = 0; c < bind_data.names.size(); c++) {
+		if (bind_data.names[c] == column) {
+			column_idx = c;
+			break;
+		}
+	}
+	if (!column_idx.IsValid()) {
+		throw BinderException("Partition column \"%s\" is not a column of the result of the query", column);
+	}
+	auto &type = bind_data.types[column_idx.GetIndex()];
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		break;
+	default:
+		throw BinderException("Partition column \"%s\" must be an integer column - but it is of type %s", column,
+		                      type.ToString());
+	}
+	if (lower.IsNull() || upper.IsNull()) {
+		// figure out the bounds by running the query - this is as expensive as the query itself
+		if (bind_data.parameters) {
+			throw BinderException("Partitioning a parameterized postgres_query requires \"lower\" and \"upper\"");
+		}
+		auto quoted_column = KeywordHelper::WriteQuoted(column, '"');
+		auto result = transaction.GetAutocommitConnection().Query(
+		    StringUtil::Format("SELECT MIN(%s), MAX(%s) FROM (%s) AS __unnamed_subquery", quoted_column,
+		                       quoted_column, bind_data.sql));
+		if (result->IsNull(0, 0)) {
+			// the query does not return any (non-NULL) values - there is nothing to partition
+			return;
+		}
+		if (lower.IsNull()) {
+			lower = Value::BIGINT(result->GetInt64(0, 0));
+		}
+		if (upper.IsNull()) {
+			upper = Value::BIGINT(result->GetInt64(0, 1));
+		}
+	}
+	auto lower_bound = lower.GetValue<int64_t>();
+	auto upper_bound = upper.GetValue<int64_t>();
+	if (lower_bound > upper_bound) {
+		throw BinderException("The lower bound (%d) of the partitions is bigger than the upper bound (%d)",
+		                      lower_bound, upper_bound);
+	}
+	// like Spark we do not create more partitions than there are values in the range
+	auto range = hugeint_t(upper_bound) - hugeint_t(lower_bound);
+	if (range < hugeint_t(NumericCast<int64_t>(partitions))) {
+		partitions = MaxValue<idx_t>(Hugeint::Cast<idx_t>(range), 1);
+	}
+	bind_data.partition_column = column;
+	bind_data.partition_count = partitions;
+	bind_data.partition_lower = lower_bound;
+	bind_data.partition_upper = upper_bound;
+	// the query is run once per partition on separate connections - so it must not write
+	bind_data.read_only = true;
+	bind_data.pages_per_task = 1;
+	bind_data.SetTablePages(partitions);
+}
+
 static unique_ptr<FunctionData> PGQueryBind(ClientContext &context, TableFunctionBindInput &input,
                                             vector<LogicalType> &return_types, vector<string> &names) {
 	auto result = make_uniq<PostgresBindData>();
@@ -37,51 +138,69 @@ static unique_ptr<FunctionData> PGQueryBind(ClientContext &context, TableFunctio
 		sql = sql.substr(0, sql.size() - 1);
 		StringUtil::RTrim(sql);
 	}
-
-	auto &con = transaction.GetConnection();
-	auto conn = con.GetConn();
-	// prepare execution of the query to figure out the result types and names
-	auto prepared = PQprepare(conn, "", sql.c_str(), 0, nullptr);
-	PostgresResult prepared_wrapper(prepared);
-	if (!prepared) {
-		throw BinderException("Failed to prepare query \"%s\" (no result returned): %s", sql, PQerrorMessage(conn));
+	// any remaining arguments are bound to the parameters ($1, $2, ...) of the query
+	vector<Value> parameter_values;
+	for (idx_t i = 2; i < input.inputs.size(); i++) {
+		parameter_values.push_back(input.inputs[i]);
 	}
-	if (PQresultStatus(prepared) != PGRES_COMMAND_OK) {
-		throw BinderException("Failed to prepare query \"%s\": %s", sql, PQresultErrorMessage(prepared));
+	if (!parameter_values.empty()) {
+		result->parameters = make_shared_ptr<PostgresQueryParameters>(parameter_values);
 	}
-	// use describe_prepared
-	auto describe_prepared = PQdescribePrepared(conn, "");
-	PostgresResult describe_wrapper(describe_prepared);
-	if (!describe_prepared || PQresultStatus(describe_prepared) != PGRES_COMMAND_OK) {
-		auto extended_err = describe_prepared ? PQresultErrorMessage(describe_prepared) : PQerrorMessage(conn);
-		throw BinderException("Failed to describe prepared statement: %s", extended_err);
+	// the result schema can depend on the types of the parameters
+	auto cache_key = sql;
+	if (result->parameters) {
+		for (auto &type : result->parameters->types) {
+			cache_key += "\n" + to_string(type);
+		}
 	}
-	auto nfields = PQnfields(describe_prepared);
-	if (nfields <= 0) {
-		throw BinderException("No fields returned by query \"%s\" - the query must be a SELECT statement that returns "
-		                      "at least one column",
-		                      sql);
+
+	// once the transaction has written, its view of the result schema is not necessarily visible to others
+	auto &query_cache = pg_catalog.GetQueryCache();
+	bool use_query_cache = !transaction.HasWrites();
+	shared_ptr<PostgresQueryDescription> description;
+	if (use_query_cache) {
+		description = query_cache.Get(cache_key);
 	}
-	for (idx_t c = 0; c < nfields; c++) {
-		PostgresType postgres_type;
-		postgres_type.oid = PQftype(describe_prepared, c);
-		PostgresTypeData type_data;
-		type_data.type_name = PostgresUtils::PostgresOidToName(postgres_type.oid);
-		type_data.type_modifier = PQfmod(describe_prepared, c);
-		auto converted_type = PostgresUtils::TypeToLogicalType(nullptr, nullptr, type_data, postgres_type);
-		result->postgres_types.push_back(postgres_type);
-		return_types.emplace_back(converted_type);
-		names.emplace_back(PQfname(describe_prepared, c));
+	if (!description) {
+		description = PGDescribeQuery(transaction, sql, result->parameters.get());
+		if (use_query_cache) {
+			query_cache.Insert(cache_key, description);
+		}
 	}
+	names = description->names;
+	return_types = description->types;
+	result->postgres_types = description->postgres_types;
 
 	// set up the bind data
 	result->SetCatalog(pg_catalog);
-	result->dsn = con.GetDSN();
+	result->dsn = transaction.GetDSN();
 	result->types = return_types;
 	result->names = names;
 	result->read_only = false;
 	result->SetTablePages(0);
 	result->sql = std::move(sql);
+
+	string partition_column;
+	idx_t partitions = 0;
+	Value lower;
+	Value upper;
+	for (auto &kv : input.named_parameters) {
+		if (kv.second.IsNull()) {
+			throw BinderException("Parameters to postgres_query cannot be NULL");
+		}
+		if (kv.first == "partition_column") {
+			partition_column = StringValue::Get(kv.second);
+		} else if (kv.first == "partitions") {
+			partitions = UBigIntValue::Get(kv.second);
+		} else if (kv.first == "lower") {
+			lower = kv.second;
+		} else if (kv.first == "upper") {
+			upper = kv.second;
+		}
+	}
+	if (!input.named_parameters.empty()) {
+		PGPartitionQuery(transaction, *result, partition_column, partitions, std::move(lower), std::move(upper));
+	}
 	return std::move(result);
 }
 
@@ -93,5 +212,10 @@ PostgresQueryFunction::PostgresQueryFunction()
 	function = scan_function.function;
 	projection_pushdown = true;
 	global_initialization = TableFunctionInitialization::INITIALIZE_ON_SCHEDULE;
+	varargs = LogicalType::ANY;
+	named_parameters["partition_column"] = LogicalType::VARCHAR;
+	named_parameters["partitions"] = LogicalType::UBIGINT;
+	named_parameters["lower"] = LogicalType::BIGINT;
+	named_parameters["upper"] = LogicalType::BIGINT;
 }
 } // namespace duckdb
@@ -6,6 +6,9 @@
 #include "duckdb/common/shared_ptr.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "postgres_filter_pushdown.hpp"
 #include "postgres_scanner.hpp"
 #include "postgres_result.hpp"
@@ -13,6 +16,7 @@
 #include "storage/postgres_catalog.hpp"
 #include "storage/postgres_transaction.hpp"
 #include "storage/postgres_table_set.hpp"
+#include "storage/postgres_replica_cache.hpp"
 
 namespace duckdb {
 
@@ -29,11 +33,52 @@ struct PostgresLocalState : public LocalTableFunctionState {
 	TableFilterSet *filters;
 	string col_names;
 	PostgresConnection connection;
+	//! The statements that set up the transaction of the connection - sent together with the first COPY
+	string setup_sql;
 	idx_t batch_idx = 0;
 	PostgresPoolConnection pool_connection;
+	//! Whether or not a task that fails because the connection is lost can be retried on a new connection
+	//! This is only possible if the connection imported a snapshot that is still held by the main connection
+	bool can_retry = false;
+	idx_t retry_count = 0;
+	//! The amount of rows the current task has emitted so far
+	idx_t task_rows = 0;
+	//! The amount of rows that have already been emitted before the current task was retried
+	idx_t skip_rows = 0;
 
 	void ScanChunk(ClientContext &context, const PostgresBindData &bind_data, PostgresGlobalState &gstate,
 	               DataChunk &output);
+	//! Decodes the next batch of rows that was received through the single connection of the scan
+	void ScanBatch(const PostgresBindData &bind_data, PostgresGlobalState &gstate, DataChunk &output);
+
+private:
+	void ReadRow(PostgresBinaryReader &reader, const PostgresBindData &bind_data, DataChunk &output,
+	             idx_t output_offset);
+	bool TryRetryTask(const PostgresBindData &bind_data, PostgresGlobalState &gstate, PostgresBinaryReader &reader);
+};
+
+//! A batch of raw rows of a COPY - the tuple counts are stripped
+struct PostgresRowBatch {
+	idx_t batch_idx = 0;
+	string data;
+	//! The offset of every row within data
+	vector<idx_t> offsets;
+};
+
+//! The rows of a scan that runs through a single connection - the rows are received by one thread at a time, while any
+//! number of threads decode the batches that have already been received
+struct PostgresStreamState {
+	mutex lock;
+	//! The local state that holds the connection and the query of the scan
+	unique_ptr<PostgresLocalState> receiver;
+	//! The parameters of a parameterized postgres_query (if any)
+	shared_ptr<PostgresQueryParameters> parameters;
+	unique_ptr<PostgresBinaryReader> reader;
+	idx_t next_batch_idx = 0;
+	bool finished = false;
+
+	//! Receives the next batch of rows - returns false once the stream is exhausted
+	bool ReceiveBatch(PostgresRowBatch &batch);
 };
 
 struct PostgresGlobalState : public GlobalTableFunctionState {
@@ -44,20 +89,48 @@ struct PostgresGlobalState : public GlobalTableFunctionState {
 	idx_t page_idx;
 	idx_t batch_idx;
 	idx_t max_threads;
-	unique_ptr<ColumnDataCollection> collection;
+	shared_ptr<ColumnDataCollection> collection;
 	ColumnDataScanState scan_state;
 	bool used_main_thread = false;
 	string snapshot;
+	//! Whether or not the scan can use the main connection of the transaction
+	bool can_use_main_thread = true;
+	//! The maximum amount of times a task is retried after the connection it runs on is lost
+	idx_t max_task_retries = 0;
+	//! The remote scan that is shared with other scans of the same table (if any)
+	shared_ptr<PostgresSharedScan> shared_scan;
+	//! The result of the shared scan in this execution of the query
+	shared_ptr<ColumnDataCollection> shared_collection;
+	//! The column of the shared scan that holds whether or not a row passes the filters of this scan
+	optional_idx shared_filter_column;
+	DataChunk shared_chunk;
+	//! The scan of the local replica of the table (if any)
+	unique_ptr<PostgresReplicaScan> replica;
+	//! The columns that are read from the local replica
+	vector<column_t> replica_column_ids;
+	//! The chunk of the local replica that is currently emitted
+	unique_ptr<DataChunk> replica_chunk;
+	//! The pooled connection the main connection of a postgres_scan that does not go through an attached database
+	//! belongs to
+	PostgresPoolConnection pool_connection;
+	//! The rows of a scan that runs through a single connection but is decoded by multiple threads (if any)
+	unique_ptr<PostgresStreamState> stream;
 
 	PostgresConnection &GetConnection();
 	void SetConnection(PostgresConnection connection);
 	void SetConnection(shared_ptr<OwnedPostgresConnection> connection);
 
 	bool TryOpenNewConnection(ClientContext &context, PostgresLocalState &lstate, const PostgresBindData &bind_data);
+	//! Wait for a connection to free up so that a thread that could not get a connection at the start of the scan
+	//! can join it later on - returns false if the timeout expires or no tasks are left to join
+	bool TryJoinScan(ClientContext &context, PostgresLocalState &lstate, const PostgresBindData &bind_data);
 	idx_t MaxThreads() const override {
 		return max_threads;
 	}
 
+private:
+	void ConnectLocalState(PostgresLocalState &lstate, const PostgresBindData &bind_data);
+
 private:
 	PostgresConnection connection;
 };
@@ -67,7 +140,8 @@ static void PostgresGetSnapshot(PostgresVersion version, const PostgresBindData
 	unique_ptr<PostgresResult> result;
 	// by default disable snapshotting
 	gstate.snapshot = string();
-	if (gstate.max_threads <= 1) {
+	// we need a snapshot if the scan runs in parallel or if it cannot use the main connection
+	if (gstate.max_threads <= 1 && bind_data.can_use_main_thread) {
 		return;
 	}
 	if (version.type_v == PostgresInstanceType::AURORA) {
@@ -86,12 +160,23 @@ static void PostgresGetSnapshot(PostgresVersion version, const PostgresBindData
 		}
 		return;
 	}
-
-	result =
-	    con.TryQuery("SELECT pg_is_in_recovery(), pg_export_snapshot(), (select count(*) from pg_stat_wal_receiver)");
+	// txid_current_if_assigned was introduced in PostgreSQL 10
+	if (version < PostgresVersion(10, 0, 0)) {
+		result = con.TryQuery(
+		    "SELECT pg_is_in_recovery(), pg_export_snapshot(), (select count(*) from pg_stat_wal_receiver)");
+	} else {
+		result = con.TryQuery("SELECT pg_is_in_recovery(), pg_export_snapshot(), (select count(*) from "
+		                      "pg_stat_wal_receiver), txid_current_if_assigned() IS NULL");
+	}
 	if (result) {
 		auto in_recovery = result->GetBool(0, 0) || result->GetInt64(0, 2) > 0;
 		gstate.snapshot = "";
+		if (version >= PostgresVersion(10, 0, 0) && !result->GetBool(0, 3)) {
+			// the transaction has written data that is not visible through the exported snapshot
+			// only the main connection can see the writes
+			gstate.max_threads = 1;
+			return;
+		}
 		if (!in_recovery) {
 			gstate.snapshot = result->GetString(0, 1);
 		}
@@ -99,6 +184,24 @@ static void PostgresGetSnapshot(PostgresVersion version, const PostgresBindData
 	}
 }
 
+//! Export the snapshot of the transaction so that a scan can stream on a separate connection
+//! This is only possible if the transaction has not written anything yet, as other connections cannot see these writes
+static void PostgresGetTransactionSnapshot(PostgresVersion version, PostgresGlobalState &gstate) {
+	gstate.snapshot = string();
+	// txid_current_if_assigned was introduced in PostgreSQL 10
+	if (version < PostgresVersion(10, 0, 0) || version.type_v == PostgresInstanceType::AURORA) {
+		return;
+	}
+	auto &con = gstate.GetConnection();
+	auto result = con.TryQuery("SELECT txid_current_if_assigned() IS NULL, CASE WHEN pg_is_in_recovery() THEN NULL "
+	                           "ELSE pg_export_snapshot() END");
+	if (!result || !result->GetBool(0, 0) || result->IsNull(0, 1)) {
+		// the transaction has written data or we cannot export snapshots
+		return;
+	}
+	gstate.snapshot = result->GetString(0, 1);
+}
+
 void PostgresScanFunction::PrepareBind(PostgresVersion version, ClientContext &context, PostgresBindData &bind_data,
                                        idx_t approx_num_pages) {
 	Value pages_per_task;
@@ -150,6 +253,16 @@ void PostgresBindData::SetCatalog(PostgresCatalog &catalog) {
 	this->pg_catalog = &catalog;
 }
 
+PostgresConnectionPool &PostgresBindData::GetConnectionPool() const {
+	if (pg_catalog) {
+		return pg_catalog->GetConnectionPool();
+	}
+	if (!connection_pool) {
+		throw InternalException("PostgresBindData::GetConnectionPool called without a connection pool");
+	}
+	return *connection_pool;
+}
+
 static unique_ptr<FunctionData> PostgresBind(ClientContext &context, TableFunctionBindInput &input,
                                              vector<LogicalType> &return_types, vector<string> &names) {
 	auto bind_data = make_uniq<PostgresBindData>();
@@ -158,7 +271,10 @@ static unique_ptr<FunctionData> PostgresBind(ClientContext &context, TableFuncti
 	bind_data->schema_name = input.inputs[1].GetValue<string>();
 	bind_data->table_name = input.inputs[2].GetValue<string>();
 
-	auto con = PostgresConnection::Open(bind_data->dsn);
+	bind_data->connection_pool = PostgresConnectionPoolRegistry::Get().GetPool(bind_data->dsn);
+	auto pool_connection =
+	    bind_data->connection_pool->GetConnection(PostgresConnectionPool::GetAcquireTimeout(context));
+	auto &con = pool_connection.GetConnection();
 	auto version = con.GetPostgresVersion();
 	// query the table schema so we can interpret the bits in the pages
 	auto info = PostgresTableSet::GetTableInfo(con, bind_data->schema_name, bind_data->table_name);
@@ -189,52 +305,98 @@ static bool ContainsCastToVarchar(const PostgresType &type) {
 	return false;
 }
 
-static void PostgresInitInternal(ClientContext &context, const PostgresBindData *bind_data_p,
-                                 PostgresLocalState &lstate, idx_t task_min, idx_t task_max) {
-	D_ASSERT(bind_data_p);
-	D_ASSERT(task_min <= task_max);
-
-	auto bind_data = (const PostgresBindData *)bind_data_p;
-
+static string PostgresGetColumnNames(const PostgresBindData &bind_data, const vector<column_t> &column_ids) {
 	string col_names;
-	for (auto &column_id : lstate.column_ids) {
+	for (auto &column_id : column_ids) {
 		if (!col_names.empty()) {
 			col_names += ", ";
 		}
 		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
-			if (bind_data->table_name.empty() || !bind_data->emit_ctid) {
+			if (bind_data.table_name.empty() || !bind_data.emit_ctid) {
 				// count(*) over postgres_query
 				col_names += "NULL";
 			} else {
 				col_names += "ctid";
 			}
 		} else {
-			col_names += KeywordHelper::WriteQuoted(bind_data->names[column_id], '"');
-			if (bind_data->postgres_types[column_id].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
+			col_names += KeywordHelper::WriteQuoted(bind_data.names[column_id], '"');
+			if (bind_data.postgres_types[column_id].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
 				col_names += "::VARCHAR";
-			} else if (bind_data->types[column_id].id() == LogicalTypeId::LIST) {
-				if (bind_data->postgres_types[column_id].info != PostgresTypeAnnotation::STANDARD) {
+			} else if (bind_data.types[column_id].id() == LogicalTypeId::LIST) {
+				if (bind_data.postgres_types[column_id].info != PostgresTypeAnnotation::STANDARD) {
 					continue;
 				}
-				if (bind_data->postgres_types[column_id].children[0].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
+				if (bind_data.postgres_types[column_id].children[0].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
 					col_names += "::VARCHAR[]";
 				}
 			} else {
-				if (ContainsCastToVarchar(bind_data->postgres_types[column_id])) {
+				if (ContainsCastToVarchar(bind_data.postgres_types[column_id])) {
 					throw NotImplementedException("Error reading table \"%s\" - cast to varchar not implemented for "
 					                              "composite column \"%s\" (type %s)",
-					                              bind_data->table_name, bind_data->names[column_id],
-					                              bind_data->types[column_id].ToString());
+					                              bind_data.table_name, bind_data.names[column_id],
+					                              bind_data.types[column_id].ToString());
 				}
 			}
 		}
 	}
+	return col_names;
+}
+
+static string PostgresGetTableCopyQuery(const PostgresBindData &bind_data, const string &col_names,
+                                       const string &filter) {
+	return StringUtil::Format(
+	    R"(
+	COPY (SELECT %s FROM %s.%s %s) TO STDOUT binary);
+	)",
+	    col_names, KeywordHelper::WriteQuoted(bind_data.schema_name, '"'),
+	    KeywordHelper::WriteQuoted(bind_data.table_name, '"'), filter);
+}
+
+//! Returns the filter that selects the partitions [partition_min, partition_max) of a partitioned postgres_query
+//! The first partition includes everything below the lower bound (and NULL), the last everything above the upper
+//! bound - so that every row is read exactly once regardless of the bounds
+static string PostgresGetPartitionFilter(const PostgresBindData &bind_data, idx_t partition_min, idx_t partition_max) {
+	auto column = KeywordHelper::WriteQuoted(bind_data.partition_column, '"');
+	auto get_bound = [&](idx_t partition_idx) {
+		// lower + (upper - lower) * idx / count - computed as hugeint so that it cannot overflow
+		auto range = hugeint_t(bind_data.partition_upper) - hugeint_t(bind_data.partition_lower);
+		auto offset = range * hugeint_t(partition_idx) / hugeint_t(bind_data.partition_count);
+		return to_string(Hugeint::Cast<int64_t>(hugeint_t(bind_data.partition_lower) + offset));
+	};
+	string filter;
+	if (partition_min > 0) {
+		filter = column + " >= " + get_bound(partition_min);
+	}
+	if (partition_max < bind_data.partition_count) {
+		auto upper_filter = column + " < " + get_bound(partition_max);
+		if (partition_min == 0) {
+			filter = "(" + upper_filter + " OR " + column + " IS NULL)";
+		} else {
+			filter += " AND " + upper_filter;
+		}
+	}
+	return filter;
+}
+
+static void PostgresInitInternal(ClientContext &context, const PostgresBindData *bind_data_p,
+                                 PostgresLocalState &lstate, idx_t task_min, idx_t task_max) {
+	D_ASSERT(bind_data_p);
+	D_ASSERT(task_min <= task_max);
+
+	auto bind_data = (const PostgresBindData *)bind_data_p;
+
+	auto col_names = PostgresGetColumnNames(*bind_data, lstate.column_ids);
 
 	string filter_string =
 	    PostgresFilterPushdown::TransformFilters(lstate.column_ids, lstate.filters, bind_data->names);
 
 	string filter;
-	if (bind_data->pages_approx > 0) {
+	if (!bind_data->partition_column.empty()) {
+		filter = PostgresGetPartitionFilter(*bind_data, task_min, task_max);
+		if (!filter.empty()) {
+			filter = "WHERE " + filter;
+		}
+	} else if (bind_data->pages_approx > 0) {
 		filter = StringUtil::Format("WHERE ctid BETWEEN '(%d,0)'::tid AND '(%d,0)'::tid", task_min, task_max);
 	}
 	if (!filter_string.empty()) {
@@ -245,7 +407,12 @@ static void PostgresInitInternal(ClientContext &context, const PostgresBindData
 		}
 		filter += filter_string;
 	}
-	if (bind_data->table_name.empty()) {
+	if (bind_data->parameters) {
+		// COPY does not accept parameters - parameterized queries are sent as a regular query
+		D_ASSERT(!bind_data->sql.empty());
+		lstate.sql = StringUtil::Format("SELECT %s FROM (%s) AS __unnamed_subquery %s", col_names, bind_data->sql,
+		                                filter);
+	} else if (bind_data->table_name.empty()) {
 		D_ASSERT(!bind_data->sql.empty());
 		lstate.sql = StringUtil::Format(
 		    R"(
@@ -254,15 +421,12 @@ static void PostgresInitInternal(ClientContext &context, const PostgresBindData
 		    col_names, bind_data->sql, filter);
 
 	} else {
-		lstate.sql = StringUtil::Format(
-		    R"(
-	COPY (SELECT %s FROM %s.%s %s) TO STDOUT binary);
-	)",
-		    col_names, KeywordHelper::WriteQuoted(bind_data->schema_name, '"'),
-		    KeywordHelper::WriteQuoted(bind_data->table_name, '"'), filter);
+		lstate.sql = PostgresGetTableCopyQuery(*bind_data, col_names, filter);
 	}
 	lstate.exec = false;
 	lstate.done = false;
+	lstate.task_rows = 0;
+	lstate.skip_rows = 0;
 }
 
 static idx_t PostgresMaxThreads(ClientContext &context, const FunctionData *bind_data_p) {
@@ -277,54 +441,513 @@ static idx_t PostgresMaxThreads(ClientContext &context, const FunctionData *bind
 static unique_ptr<LocalTableFunctionState> GetLocalState(ClientContext &context, TableFunctionInitInput &input,
                                                          PostgresGlobalState &gstate);
 
-static void PostgresScanConnect(PostgresConnection &conn, string snapshot) {
-	conn.Execute("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY");
+static optional_idx PostgresGetMaterializationLimit(ClientContext &context) {
+	Value max_size;
+	if (!context.TryGetCurrentSetting("pg_max_materialization_size", max_size) || max_size.IsNull()) {
+		return optional_idx();
+	}
+	return DBConfig::ParseMemoryLimit(StringValue::Get(max_size));
+}
+
+static optional_idx PostgresGetScanCacheSize(ClientContext &context) {
+	Value cache_size;
+	if (!context.TryGetCurrentSetting("pg_scan_cache_size", cache_size) || cache_size.IsNull()) {
+		return optional_idx();
+	}
+	return DBConfig::ParseMemoryLimit(StringValue::Get(cache_size));
+}
+
+static bool PostgresUseParallelDecode(ClientContext &context) {
+	Value parallel_decode;
+	if (context.TryGetCurrentSetting("pg_parallel_decode", parallel_decode) && !BooleanValue::Get(parallel_decode)) {
+		return false;
+	}
+	return TaskScheduler::GetScheduler(context).NumberOfThreads() > 1;
+}
+
+//! Returns the key under which the result of the scan is cached - or an empty string if the scan cannot be cached
+static string PostgresGetScanCacheKey(ClientContext &context, TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<PostgresBindData>();
+	auto pg_catalog = bind_data.GetCatalog();
+	if (!pg_catalog || bind_data.table_name.empty() || bind_data.shared_scan) {
+		return string();
+	}
+	auto cache_size = PostgresGetScanCacheSize(context);
+	if (!cache_size.IsValid() || cache_size.GetIndex() == 0) {
+		return string();
+	}
+	if (context.transaction.IsAutoCommit()) {
+		// the cache lives as long as the transaction - an auto-commit statement cannot reuse a cached result, so
+		// materializing the scan would only cost its parallelism
+		return string();
+	}
+	auto &transaction = Transaction::Get(context, *pg_catalog).Cast<PostgresTransaction>();
+	if (transaction.HasWrites()) {
+		// once the transaction has written data scans are no longer cached
+		return string();
+	}
+	// scans within the same transaction share the same snapshot - the snapshot is implied by the transaction
+	return StringUtil::Format(
+	    "%s.%s|%s|%s", KeywordHelper::WriteQuoted(bind_data.schema_name, '"'),
+	    KeywordHelper::WriteQuoted(bind_data.table_name, '"'), PostgresGetColumnNames(bind_data, input.column_ids),
+	    PostgresFilterPushdown::TransformFilters(input.column_ids, input.filters, bind_data.names));
+}
+
+static void PostgresCheckMaterializationLimit(const PostgresBindData &bind_data, ColumnDataCollection &materialized,
+                                              optional_idx max_size) {
+	if (max_size.IsValid() && materialized.SizeInBytes() > max_size.GetIndex()) {
+		throw OutOfMemoryException(
+		    "Materializing the Postgres scan of table \"%s\" exceeded the limit of %s set by "
+		    "pg_max_materialization_size. Scans are materialized when the transaction has already written to "
+		    "Postgres or when multiple scans of the same database appear in a read-write transaction - "
+		    "increase the limit, or run the query in a separate transaction",
+		    bind_data.table_name, StringUtil::BytesToHumanReadableString(max_size.GetIndex()));
+	}
+}
+
+//! Returns the statements that start the transaction of a scan connection - these are sent together with the first
+//! query on the connection so that setting up the connection does not cost any additional round trips
+static string PostgresScanSetupQuery(const string &snapshot, PostgresVersion version = PostgresVersion(),
+                                     bool stable_order = false) {
+	string query = "BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY;\n";
 	if (!snapshot.empty()) {
-		conn.Query(StringUtil::Format("SET TRANSACTION SNAPSHOT '%s'", snapshot));
+		query += StringUtil::Format("SET TRANSACTION SNAPSHOT '%s';\n", snapshot);
+	}
+	if (stable_order) {
+		// a retried task skips the rows it has already emitted - this requires every run of the task to return the
+		// rows in the same order, which synchronized and parallel sequential scans do not guarantee
+		query += "SET LOCAL synchronize_seqscans TO off;\n";
+		if (version >= PostgresVersion(9, 6, 0)) {
+			query += "SET LOCAL max_parallel_workers_per_gather TO 0;\n";
+		}
+	}
+	return query;
+}
+
+//! Scan and materialize the table in its entirety up-front through the main connection
+static void PostgresMaterializeScan(ClientContext &context, TableFunctionInitInput &input,
+                                    PostgresGlobalState &gstate) {
+	auto &bind_data = input.bind_data->Cast<PostgresBindData>();
+	vector<LogicalType> types;
+	for (auto column_id : input.column_ids) {
+		types.push_back(column_id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::BIGINT : bind_data.types[column_id]);
+	}
+	// materialize into a buffer-managed collection so that it respects the memory limit and can be spilled
+	auto materialized = make_uniq<ColumnDataCollection>(context, types);
+	auto max_size = PostgresGetMaterializationLimit(context);
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(Allocator::Get(context), types);
+
+	auto local_state = GetLocalState(context, input, gstate);
+	auto &lstate = local_state->Cast<PostgresLocalState>();
+	ColumnDataAppendState append_state;
+	materialized->InitializeAppend(append_state);
+	while (true) {
+		scan_chunk.Reset();
+		lstate.ScanChunk(context, bind_data, gstate, scan_chunk);
+		if (scan_chunk.size() == 0) {
+			break;
+		}
+		materialized->Append(append_state, scan_chunk);
+		PostgresCheckMaterializationLimit(bind_data, *materialized, max_size);
+	}
+	gstate.collection = std::move(materialized);
+	gstate.collection->InitializeScan(gstate.scan_state);
+}
+
+//! Creates bind data for reading the table in a single COPY - instead of splitting it into page ranges
+static unique_ptr<PostgresBindData> PostgresCreateCopyBindData(const PostgresBindData &bind_data) {
+	auto scan_data = make_uniq<PostgresBindData>();
+	scan_data->version = bind_data.version;
+	scan_data->schema_name = bind_data.schema_name;
+	scan_data->table_name = bind_data.table_name;
+	scan_data->names = bind_data.names;
+	scan_data->types = bind_data.types;
+	scan_data->postgres_types = bind_data.postgres_types;
+	scan_data->emit_ctid = bind_data.emit_ctid;
+	return scan_data;
+}
+
+//! Reads the table in a single COPY and materializes the result
+static unique_ptr<ColumnDataCollection> PostgresMaterializeCopy(ClientContext &context,
+                                                                const PostgresBindData &scan_data,
+                                                                PostgresGlobalState &gstate, PostgresConnection &con,
+                                                                const vector<column_t> &column_ids,
+                                                                const string &col_names, const string &filter,
+                                                                optional_idx max_size) {
+	PostgresLocalState lstate;
+	lstate.column_ids = column_ids;
+	lstate.sql = PostgresGetTableCopyQuery(scan_data, col_names, filter.empty() ? string() : "WHERE " + filter);
+	lstate.connection = PostgresConnection(con.GetConnection());
+
+	vector<LogicalType> types;
+	for (auto column_id : column_ids) {
+		types.push_back(column_id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::BIGINT : scan_data.types[column_id]);
+	}
+	auto materialized = make_uniq<ColumnDataCollection>(context, types);
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(Allocator::Get(context), types);
+	ColumnDataAppendState append_state;
+	materialized->InitializeAppend(append_state);
+	while (true) {
+		scan_chunk.Reset();
+		lstate.ScanChunk(context, scan_data, gstate, scan_chunk);
+		if (scan_chunk.size() == 0) {
+			break;
+		}
+		materialized->Append(append_state, scan_chunk);
+		PostgresCheckMaterializationLimit(scan_data, *materialized, max_size);
+	}
+	return materialized;
+}
+
+optional_idx PostgresSharedScan::GetFilterColumn(idx_t scan_idx) const {
+	if (filters[scan_idx].empty()) {
+		return optional_idx();
+	}
+	// the filter columns are placed after the scanned columns - one for every scan that has filters
+	idx_t filter_column = column_ids.size();
+	for (idx_t i = 0; i < scan_idx; i++) {
+		if (!filters[i].empty()) {
+			filter_column++;
+		}
+	}
+	return filter_column;
+}
+
+shared_ptr<PostgresSharedScanState> PostgresSharedScanState::Get(ClientContext &context) {
+	return context.registered_state->GetOrCreate<PostgresSharedScanState>("postgres_shared_scans");
+}
+
+shared_ptr<ColumnDataCollection> PostgresSharedScanState::GetResult(const PostgresSharedScan &scan) {
+	lock_guard<mutex> guard(lock);
+	auto entry = results.find(&scan);
+	if (entry == results.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+void PostgresSharedScanState::SetResult(const PostgresSharedScan &scan, shared_ptr<ColumnDataCollection> result) {
+	lock_guard<mutex> guard(lock);
+	results[&scan] = std::move(result);
+}
+
+void PostgresSharedScanState::QueryEnd() {
+	lock_guard<mutex> guard(lock);
+	results.clear();
+}
+
+//! Run the remote scan that is shared between scans of the same table - this is only done once per execution
+static shared_ptr<ColumnDataCollection> PostgresMaterializeSharedScan(ClientContext &context,
+                                                                      const PostgresBindData &bind_data,
+                                                                      PostgresGlobalState &gstate) {
+	auto &shared_scan = *bind_data.shared_scan;
+	auto state = PostgresSharedScanState::Get(context);
+	lock_guard<mutex> guard(shared_scan.lock);
+	auto result = state->GetResult(shared_scan);
+	if (result) {
+		// another scan has already read the table
+		return result;
+	}
+	// the shared scan reads the union of the columns of all scans, and a boolean column for every scan with filters
+	// the remote filter is the union (OR) of the filters - every scan then only emits the rows that pass its filters
+	auto scan_data = PostgresCreateCopyBindData(bind_data);
+	auto col_names = PostgresGetColumnNames(*scan_data, shared_scan.column_ids);
+	auto column_ids = shared_scan.column_ids;
+	string filter;
+	bool has_unfiltered_scan = false;
+	for (auto &scan_filter : shared_scan.filters) {
+		if (scan_filter.empty()) {
+			has_unfiltered_scan = true;
+			continue;
+		}
+		column_ids.push_back(scan_data->types.size());
+		scan_data->types.push_back(LogicalType::BOOLEAN);
+		scan_data->postgres_types.push_back(PostgresType());
+		col_names += StringUtil::Format(", (%s) IS TRUE", scan_filter);
+		if (!filter.empty()) {
+			filter += " OR ";
+		}
+		filter += "(" + scan_filter + ")";
+	}
+	if (has_unfiltered_scan) {
+		filter = string();
+	}
+	auto max_size = PostgresGetMaterializationLimit(context);
+	result = shared_ptr<ColumnDataCollection>(
+	    PostgresMaterializeCopy(context, *scan_data, gstate, gstate.GetConnection(), column_ids, col_names, filter,
+	                            max_size));
+	state->SetResult(shared_scan, result);
+	return result;
+}
+
+static void PostgresInitSharedScan(ClientContext &context, TableFunctionInitInput &input,
+                                   PostgresGlobalState &gstate) {
+	auto &bind_data = input.bind_data->Cast<PostgresBindData>();
+	gstate.shared_collection = PostgresMaterializeSharedScan(context, bind_data, gstate);
+
+	auto &shared_scan = *bind_data.shared_scan;
+	// find the columns of this scan in the shared result
+	vector<column_t> projection;
+	vector<LogicalType> types;
+	for (auto column_id : input.column_ids) {
+		auto entry = std::find(shared_scan.column_ids.begin(), shared_scan.column_ids.end(), column_id);
+		if (entry == shared_scan.column_ids.end()) {
+			throw InternalException("Column of Postgres scan was not found in shared scan");
+		}
+		projection.push_back(NumericCast<column_t>(entry - shared_scan.column_ids.begin()));
+		types.push_back(gstate.shared_collection->Types()[projection.back()]);
+	}
+	gstate.shared_filter_column = shared_scan.GetFilterColumn(bind_data.shared_scan_idx);
+	if (gstate.shared_filter_column.IsValid()) {
+		projection.push_back(gstate.shared_filter_column.GetIndex());
+		types.push_back(LogicalType::BOOLEAN);
+		gstate.shared_chunk.Initialize(Allocator::Get(context), types);
 	}
+	gstate.shared_scan = bind_data.shared_scan;
+	gstate.shared_collection->InitializeScan(gstate.scan_state, std::move(projection));
+	gstate.max_threads = 1;
+}
+
+static void PostgresScanShared(PostgresGlobalState &gstate, DataChunk &output) {
+	auto &collection = *gstate.shared_collection;
+	if (!gstate.shared_filter_column.IsValid()) {
+		collection.Scan(gstate.scan_state, output);
+		return;
+	}
+	// only emit the rows that pass the filters of this scan
+	auto &chunk = gstate.shared_chunk;
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	while (true) {
+		chunk.Reset();
+		if (!collection.Scan(gstate.scan_state, chunk)) {
+			return;
+		}
+		auto &filter_vector = chunk.data.back();
+		UnifiedVectorFormat filter_data;
+		filter_vector.ToUnifiedFormat(chunk.size(), filter_data);
+		auto passes_filter = UnifiedVectorFormat::GetData<bool>(filter_data);
+		idx_t count = 0;
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			auto idx = filter_data.sel->get_index(i);
+			if (filter_data.validity.RowIsValid(idx) && passes_filter[idx]) {
+				sel.set_index(count++, i);
+			}
+		}
+		if (count == 0) {
+			continue;
+		}
+		for (idx_t col_idx = 0; col_idx < output.ColumnCount(); col_idx++) {
+			output.data[col_idx].Slice(chunk.data[col_idx], sel, count);
+		}
+		output.SetCardinality(count);
+		return;
+	}
+}
+
+static bool PostgresGetReplicaVersion(PostgresConnection &con, const PostgresBindData &bind_data,
+                                      PostgresReplicaVersion &version) {
+	auto table_name = KeywordHelper::WriteQuoted(bind_data.schema_name, '"') + "." +
+	                  KeywordHelper::WriteQuoted(bind_data.table_name, '"');
+	auto result = con.Query(StringUtil::Format(
+	    "SELECT c.relkind, c.relfilenode, COALESCE(s.n_tup_ins, 0), COALESCE(s.n_tup_upd, 0), "
+	    "COALESCE(s.n_tup_del, 0) FROM pg_class c LEFT JOIN pg_stat_all_tables s ON s.relid = c.oid "
+	    "WHERE c.oid = %s::regclass",
+	    KeywordHelper::WriteQuoted(table_name, '\'')));
+	if (result->Count() == 0 || result->GetString(0, 0) != "r") {
+		// only regular tables have statistics that track all changes (e.g. not partitioned tables or views)
+		return false;
+	}
+	version.relfilenode = result->GetInt64(0, 1);
+	version.tuples_inserted = result->GetInt64(0, 2);
+	version.tuples_updated = result->GetInt64(0, 3);
+	version.tuples_deleted = result->GetInt64(0, 4);
+	for (idx_t c = 0; c < bind_data.names.size(); c++) {
+		if (c > 0) {
+			version.signature += ", ";
+		}
+		version.signature += KeywordHelper::WriteQuoted(bind_data.names[c], '"') + " " + bind_data.types[c].ToString();
+	}
+	return true;
+}
+
+//! Reads the scan from the local replica of the table - refreshing the replica if the table has changed
+//! Returns false if the table cannot be replicated
+static bool PostgresInitReplicaScan(ClientContext &context, TableFunctionInitInput &input,
+                                    PostgresGlobalState &gstate) {
+	auto &bind_data = input.bind_data->Cast<PostgresBindData>();
+	auto &pg_catalog = *bind_data.GetCatalog();
+	auto &replica_cache = *pg_catalog.GetReplicaCache();
+	// check the table on a connection outside of the transaction - so that we see the latest statistics, and the
+	// replica is at least as recent as the statistics it is stored with
+	auto pool_connection = pg_catalog.GetConnectionPool().ForceGetConnection();
+	auto &con = pool_connection.GetConnection();
+	PostgresReplicaVersion version;
+	if (!PostgresGetReplicaVersion(con, bind_data, version)) {
+		return false;
+	}
+	auto replica = replica_cache.GetTable(bind_data.schema_name, bind_data.table_name);
+	if (!replica || !(replica->version == version)) {
+		// the table has changed - refresh the replica
+		optional_idx key_column;
+		vector<column_t> column_ids;
+		for (idx_t c = 0; c < bind_data.names.size(); c++) {
+			if (bind_data.names[c] == replica_cache.GetAppendKey()) {
+				key_column = c;
+			}
+			column_ids.push_back(c);
+		}
+		auto scan_data = PostgresCreateCopyBindData(bind_data);
+		for (auto &type : scan_data->types) {
+			// the replica stores plain DuckDB types - the aliases of enum and composite types are Postgres type names
+			type = PostgresUtils::RemoveAlias(type);
+		}
+		auto col_names = PostgresGetColumnNames(*scan_data, column_ids);
+		if (replica && key_column.IsValid() && !replica->last_key.IsNull() && version.IsAppendOnly(replica->version)) {
+			// rows have only been inserted - fetch the rows past the largest key we have seen
+			auto filter = StringUtil::Format("%s > %s",
+			                                 KeywordHelper::WriteQuoted(bind_data.names[key_column.GetIndex()], '"'),
+			                                 KeywordHelper::WriteQuoted(replica->last_key.ToString(), '\''));
+			auto rows = PostgresMaterializeCopy(context, *scan_data, gstate, con, column_ids, col_names, filter,
+			                                    optional_idx());
+			replica = replica_cache.AppendTable(bind_data.schema_name, bind_data.table_name, std::move(version), *rows,
+			                                    key_column);
+		} else {
+			auto rows = PostgresMaterializeCopy(context, *scan_data, gstate, con, column_ids, col_names, string(),
+			                                    optional_idx());
+			replica = replica_cache.StoreTable(bind_data.schema_name, bind_data.table_name, std::move(version), *rows,
+			                                   key_column);
+		}
+	}
+	// row ids are not stored in the replica - we read an arbitrary column in their place and emit NULL
+	vector<column_t> projection;
+	for (auto column_id : input.column_ids) {
+		projection.push_back(column_id == COLUMN_IDENTIFIER_ROW_ID ? 0 : column_id);
+	}
+	// the rows are streamed from the local database instead of being kept in memory
+	gstate.replica = replica_cache.ScanTable(*replica, projection);
+	gstate.replica_column_ids = input.column_ids;
+	gstate.max_threads = 1;
+	return true;
+}
+
+static void PostgresScanReplica(PostgresGlobalState &gstate, DataChunk &output) {
+	auto &result = *gstate.replica->result;
+	auto &chunk = gstate.replica_chunk;
+	do {
+		chunk = result.Fetch();
+		if (result.HasError()) {
+			result.ThrowError("Failed to read Postgres replica cache: ");
+		}
+		if (!chunk) {
+			return;
+		}
+	} while (chunk->size() == 0);
+	for (idx_t c = 0; c < output.ColumnCount(); c++) {
+		if (gstate.replica_column_ids[c] == COLUMN_IDENTIFIER_ROW_ID) {
+			output.data[c].SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(output.data[c], true);
+		} else if (output.data[c].GetType() == chunk->data[c].GetType()) {
+			output.data[c].Reference(chunk->data[c]);
+		} else {
+			// the replica stores the types without the aliases of enum and composite types
+			VectorOperations::Copy(chunk->data[c], output.data[c], chunk->size(), 0, 0);
+		}
+	}
+	output.SetCardinality(chunk->size());
 }
 
 static unique_ptr<GlobalTableFunctionState> PostgresInitGlobalState(ClientContext &context,
                                                                     TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<PostgresBindData>();
 	auto result = make_uniq<PostgresGlobalState>(PostgresMaxThreads(context, input.bind_data.get()));
+	Value max_task_retries;
+	if (context.TryGetCurrentSetting("pg_scan_task_retries", max_task_retries)) {
+		result->max_task_retries = UBigIntValue::Get(max_task_retries);
+	}
 	auto pg_catalog = bind_data.GetCatalog();
 	if (pg_catalog) {
 		auto &transaction = Transaction::Get(context, *pg_catalog).Cast<PostgresTransaction>();
-		auto &con = transaction.GetConnection();
+		// a scan that runs as a single COPY on the main connection does not need a transaction in autocommit mode
+		bool single_statement =
+		    result->max_threads <= 1 && bind_data.can_use_main_thread && !bind_data.can_stream_from_snapshot;
+		auto &con = single_statement ? transaction.GetAutocommitConnection() : transaction.GetConnection();
 		result->SetConnection(con.GetConnection());
 	} else {
-		auto con = PostgresConnection::Open(bind_data.dsn);
-		PostgresScanConnect(con, string());
-		result->SetConnection(std::move(con));
+		auto pool_connection =
+		    bind_data.GetConnectionPool().GetConnection(PostgresConnectionPool::GetAcquireTimeout(context));
+		pool_connection.GetConnection().Execute(PostgresScanSetupQuery(string()));
+		result->SetConnection(pool_connection.GetConnection().GetConnection());
+		result->pool_connection = std::move(pool_connection);
 	}
-	if (bind_data.requires_materialization) {
-		// if requires_materialization is enabled we scan and materialize the table in its entirety up-front
-		vector<LogicalType> types;
-		for (auto column_id : input.column_ids) {
-			types.push_back(column_id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::BIGINT : bind_data.types[column_id]);
-		}
-		auto materialized = make_uniq<ColumnDataCollection>(Allocator::Get(context), types);
-		DataChunk scan_chunk;
-		scan_chunk.Initialize(Allocator::Get(context), types);
-
-		auto local_state = GetLocalState(context, input, *result);
-		auto &lstate = local_state->Cast<PostgresLocalState>();
-		ColumnDataAppendState append_state;
-		materialized->InitializeAppend(append_state);
-		while (true) {
-			scan_chunk.Reset();
-			lstate.ScanChunk(context, bind_data, *result, scan_chunk);
-			if (scan_chunk.size() == 0) {
-				break;
-			}
-			materialized->Append(append_state, scan_chunk);
+	if (bind_data.use_replica && !bind_data.emit_ctid && PostgresInitReplicaScan(context, input, *result)) {
+		// the scan reads from the local replica of the table
+		return std::move(result);
+	}
+	if (bind_data.shared_scan) {
+		// the table is read once and shared with other scans of the same table
+		PostgresInitSharedScan(context, input, *result);
+		return std::move(result);
+	}
+	auto cache_key = PostgresGetScanCacheKey(context, input);
+	if (!cache_key.empty()) {
+		auto &transaction = Transaction::Get(context, *pg_catalog).Cast<PostgresTransaction>();
+		auto cached_result = transaction.GetScanCache().Get(cache_key);
+		if (cached_result) {
+			// the same scan has already been executed in this transaction
+			result->collection = std::move(cached_result);
+			result->collection->InitializeScan(result->scan_state);
+			result->max_threads = 1;
+			return std::move(result);
 		}
-		result->collection = std::move(materialized);
-		result->collection->InitializeScan(result->scan_state);
+	}
+	result->can_use_main_thread = bind_data.can_use_main_thread;
+	bool stream_from_snapshot = false;
+	if (bind_data.requires_materialization && bind_data.can_stream_from_snapshot && pg_catalog) {
+		// if the transaction has not written anything yet we can stream the scan on a separate connection
+		// this avoids having to materialize the entire table in memory
+		PostgresGetTransactionSnapshot(bind_data.version, *result);
+		stream_from_snapshot = !result->snapshot.empty();
+		result->can_use_main_thread = !stream_from_snapshot;
+	}
+	if (stream_from_snapshot) {
+		// the scan reads from a separate connection - nothing to do here
+	} else if (bind_data.requires_materialization) {
+		// if requires_materialization is enabled we scan and materialize the table in its entirety up-front
+		PostgresMaterializeScan(context, input, *result);
 	} else {
 		// we create a transaction here, and get the snapshot id to enable transaction-safe parallelism
 		PostgresGetSnapshot(bind_data.version, bind_data, *result);
+		if (!bind_data.can_use_main_thread && result->snapshot.empty()) {
+			// other scans are using the main connection - but we cannot share the snapshot of the transaction
+			// (e.g. because it has already written data) - fall back to materializing through the main connection
+			result->max_threads = 1;
+			result->can_use_main_thread = true;
+			PostgresMaterializeScan(context, input, *result);
+		} else if (result->max_threads > 1) {
+			// open the connections of the scan threads up-front and concurrently rather than one by one
+			auto scheduler_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+			auto thread_count = MinValue<idx_t>(result->max_threads, scheduler_threads);
+			bind_data.GetConnectionPool().Prewarm(thread_count - (result->can_use_main_thread ? 1 : 0));
+		}
+	}
+	if (!cache_key.empty()) {
+		// materialize the scan so that the result can be cached
+		if (!result->collection) {
+			result->max_threads = 1;
+			PostgresMaterializeScan(context, input, *result);
+		}
+		auto &transaction = Transaction::Get(context, *pg_catalog).Cast<PostgresTransaction>();
+		transaction.GetScanCache().Insert(cache_key, result->collection,
+		                                  PostgresGetScanCacheSize(context).GetIndex());
+	}
+	if (!result->collection && (bind_data.pages_approx == 0 || bind_data.requires_materialization) &&
+	    PostgresUseParallelDecode(context)) {
+		// the scan reads through a single connection - decode the rows that are received on multiple threads
+		result->stream = make_uniq<PostgresStreamState>();
+		result->stream->parameters = bind_data.parameters;
+		result->max_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 	}
 	return std::move(result);
 }
@@ -353,32 +976,54 @@ static bool PostgresParallelStateNext(ClientContext &context, const FunctionData
 
 bool PostgresGlobalState::TryOpenNewConnection(ClientContext &context, PostgresLocalState &lstate,
                                                const PostgresBindData &bind_data) {
-	auto pg_catalog = bind_data.GetCatalog();
+	bool is_first_connection = false;
 	{
 		lock_guard<mutex> parallel_lock(lock);
 		if (!used_main_thread) {
-			if (bind_data.can_use_main_thread) {
+			used_main_thread = true;
+			is_first_connection = true;
+			if (can_use_main_thread) {
 				lstate.connection = PostgresConnection(GetConnection().GetConnection());
-			} else {
-				// we cannot use the main thread but we haven't initiated ANY scan yet
-				// we HAVE to open a new connection
-				lstate.pool_connection = pg_catalog->GetConnectionPool().ForceGetConnection();
-				lstate.connection = PostgresConnection(lstate.pool_connection.GetConnection().GetConnection());
+				return true;
 			}
-			used_main_thread = true;
-			return true;
 		}
 	}
 
-	if (pg_catalog) {
-		if (!pg_catalog->GetConnectionPool().TryGetConnection(lstate.pool_connection)) {
+	if (is_first_connection) {
+		// we cannot use the main thread but we haven't initiated ANY scan yet
+		// we HAVE to open a new connection
+		lstate.pool_connection = bind_data.GetConnectionPool().ForceGetConnection();
+		lstate.connection = PostgresConnection(lstate.pool_connection.GetConnection().GetConnection());
+	} else {
+		if (!bind_data.GetConnectionPool().TryGetConnection(lstate.pool_connection)) {
 			return false;
 		}
 		lstate.connection = PostgresConnection(lstate.pool_connection.GetConnection().GetConnection());
-	} else {
-		lstate.connection = PostgresConnection::Open(bind_data.dsn);
 	}
-	PostgresScanConnect(lstate.connection, snapshot);
+	ConnectLocalState(lstate, bind_data);
+	return true;
+}
+
+void PostgresGlobalState::ConnectLocalState(PostgresLocalState &lstate, const PostgresBindData &bind_data) {
+	lstate.can_retry = !snapshot.empty() && max_task_retries > 0;
+	lstate.setup_sql = PostgresScanSetupQuery(snapshot, bind_data.version, lstate.can_retry);
+}
+
+bool PostgresGlobalState::TryJoinScan(ClientContext &context, PostgresLocalState &lstate,
+                                      const PostgresBindData &bind_data) {
+	auto no_tasks_left = [&]() {
+		lock_guard<mutex> parallel_lock(lock);
+		return page_idx >= bind_data.pages_approx;
+	};
+	auto &pool = bind_data.GetConnectionPool();
+	if (!pool.TryGetConnection(lstate.pool_connection, PostgresConnectionPool::GetAcquireTimeout(context),
+	                           no_tasks_left)) {
+		return false;
+	}
+	lstate.connection = PostgresConnection(lstate.pool_connection.GetConnection().GetConnection());
+	ConnectLocalState(lstate, bind_data);
+	lstate.no_connection = false;
+	lstate.done = true;
 	return true;
 }
 
@@ -387,12 +1032,29 @@ static unique_ptr<LocalTableFunctionState> GetLocalState(ClientContext &context,
 	auto &bind_data = (PostgresBindData &)*input.bind_data;
 
 	auto local_state = make_uniq<PostgresLocalState>();
-	if (gstate.collection) {
+	if (gstate.collection || gstate.shared_scan || gstate.replica) {
 		return std::move(local_state);
 	}
 	local_state->column_ids = input.column_ids;
 
 	local_state->filters = input.filters.get();
+	if (gstate.stream) {
+		lock_guard<mutex> stream_lock(gstate.stream->lock);
+		if (!gstate.stream->receiver) {
+			// the first thread sets up the connection the rows are received through - the others only decode
+			auto receiver = make_uniq<PostgresLocalState>();
+			receiver->column_ids = input.column_ids;
+			receiver->filters = input.filters.get();
+			if (!gstate.TryOpenNewConnection(context, *receiver, bind_data)) {
+				// the receiver is the first connection of the scan - it always gets one
+				throw InternalException("Postgres stream receiver could not open a connection");
+			}
+			PostgresInitInternal(context, &bind_data, *receiver, 0, POSTGRES_TID_MAX);
+			gstate.page_idx = POSTGRES_TID_MAX;
+			gstate.stream->receiver = std::move(receiver);
+		}
+		return std::move(local_state);
+	}
 	if (!gstate.TryOpenNewConnection(context, *local_state, bind_data)) {
 		// if the connection pool is exhausted we bail-out
 		local_state->no_connection = true;
@@ -414,31 +1076,75 @@ static unique_ptr<LocalTableFunctionState> PostgresInitLocalState(ExecutionConte
 	return GetLocalState(context.client, input, gstate);
 }
 
+bool PostgresLocalState::TryRetryTask(const PostgresBindData &bind_data, PostgresGlobalState &gstate,
+                                      PostgresBinaryReader &reader) {
+	if (!can_retry || retry_count >= gstate.max_task_retries) {
+		return false;
+	}
+	auto conn = connection.GetConn();
+	// a terminated backend sends a FATAL error before closing the connection - read the remaining input, so that a
+	// connection that is being closed is not mistaken for a live one
+	if (PQstatus(conn) == CONNECTION_OK && PQconsumeInput(conn) && PQstatus(conn) == CONNECTION_OK) {
+		// the connection is still alive - the task failed for another reason
+		return false;
+	}
+	retry_count++;
+	reader.Reset();
+	// the lost connection is discarded when it is returned to the pool
+	connection = PostgresConnection();
+	pool_connection = bind_data.GetConnectionPool().ForceGetConnection();
+	connection = PostgresConnection(pool_connection.GetConnection().GetConnection());
+	// importing the snapshot fails if the main connection has been lost as well
+	setup_sql = PostgresScanSetupQuery(gstate.snapshot, bind_data.version, true);
+	// re-run the task from the start, skipping the rows that have already been emitted
+	skip_rows = task_rows;
+	task_rows = 0;
+	exec = false;
+	return true;
+}
+
 void PostgresLocalState::ScanChunk(ClientContext &context, const PostgresBindData &bind_data,
                                    PostgresGlobalState &gstate, DataChunk &output) {
 	idx_t output_offset = 0;
 	PostgresBinaryReader reader(connection);
+	reader.read_query_result = bind_data.parameters != nullptr;
 	while (true) {
 		if (done && !PostgresParallelStateNext(context, &bind_data, *this, gstate)) {
 			return;
 		}
-		if (!exec) {
-			connection.BeginCopyFrom(reader, sql);
-			exec = true;
-		}
+		try {
+			if (!exec && bind_data.parameters) {
+				if (!setup_sql.empty()) {
+					connection.Execute(setup_sql);
+					setup_sql = string();
+				}
+				connection.SendQueryParams(sql, *bind_data.parameters);
+				exec = true;
+			} else if (!exec) {
+				// the first COPY on a connection also starts its transaction - in the same round trip
+				connection.BeginCopyFrom(reader, setup_sql + sql);
+				setup_sql = string();
+				exec = true;
+			}
 
-		output.SetCardinality(output_offset);
-		if (output_offset == STANDARD_VECTOR_SIZE) {
-			return;
-		}
+			output.SetCardinality(output_offset);
+			if (output_offset == STANDARD_VECTOR_SIZE) {
+				return;
+			}
 
-		while (!reader.Ready()) {
-			if (!reader.Next()) {
-				// finished this batch
-				reader.CheckResult();
-				done = true;
-				continue;
+			while (!reader.Ready()) {
+				if (!reader.Next()) {
+					// finished this batch
+					reader.CheckResult();
+					done = true;
+					continue;
+				}
+			}
+		} catch (std::exception &ex) {
+			if (!TryRetryTask(bind_data, gstate, reader)) {
+				throw;
 			}
+			continue;
 		}
 
 		auto tuple_count = reader.ReadInteger<int16_t>();
@@ -447,26 +1153,102 @@ void PostgresLocalState::ScanChunk(ClientContext &context, const PostgresBindDat
 			done = true;
 			continue;
 		}
+		if (skip_rows > 0) {
+			// this row was already emitted before the task was retried
+			skip_rows--;
+			task_rows++;
+			reader.Reset();
+			continue;
+		}
 
 		D_ASSERT(tuple_count == column_ids.size());
 
-		for (idx_t output_idx = 0; output_idx < output.ColumnCount(); output_idx++) {
-			auto col_idx = column_ids[output_idx];
-			auto &out_vec = output.data[output_idx];
-			if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
-				// row id
-				// ctid in postgres are a composite type of (page_index, tuple_in_page)
-				// the page index is a 4-byte integer, the tuple_in_page a 2-byte integer
-				PostgresType ctid_type;
-				ctid_type.info = PostgresTypeAnnotation::CTID;
-				reader.ReadValue(LogicalType::BIGINT, ctid_type, out_vec, output_offset);
+		ReadRow(reader, bind_data, output, output_offset);
+		reader.Reset();
+		output_offset++;
+		task_rows++;
+	}
+}
+
+void PostgresLocalState::ReadRow(PostgresBinaryReader &reader, const PostgresBindData &bind_data, DataChunk &output,
+                                 idx_t output_offset) {
+	for (idx_t output_idx = 0; output_idx < output.ColumnCount(); output_idx++) {
+		auto col_idx = column_ids[output_idx];
+		auto &out_vec = output.data[output_idx];
+		if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+			// row id
+			// ctid in postgres are a composite type of (page_index, tuple_in_page)
+			// the page index is a 4-byte integer, the tuple_in_page a 2-byte integer
+			PostgresType ctid_type;
+			ctid_type.info = PostgresTypeAnnotation::CTID;
+			reader.ReadValue(LogicalType::BIGINT, ctid_type, out_vec, output_offset);
+		} else {
+			reader.ReadValue(bind_data.types[col_idx], bind_data.postgres_types[col_idx], out_vec, output_offset);
+		}
+	}
+}
+
+void PostgresLocalState::ScanBatch(const PostgresBindData &bind_data, PostgresGlobalState &gstate,
+                                   DataChunk &output) {
+	PostgresRowBatch batch;
+	if (!gstate.stream->ReceiveBatch(batch)) {
+		// the stream is exhausted
+		return;
+	}
+	batch_idx = batch.batch_idx;
+	PostgresBinaryReader reader(connection);
+	auto data = data_ptr_cast(&batch.data[0]);
+	for (idx_t row_idx = 0; row_idx < batch.offsets.size(); row_idx++) {
+		auto row_end = row_idx + 1 < batch.offsets.size() ? batch.offsets[row_idx + 1] : batch.data.size();
+		reader.SetBuffer(data + batch.offsets[row_idx], data + row_end);
+		ReadRow(reader, bind_data, output, row_idx);
+	}
+	reader.Reset();
+	output.SetCardinality(batch.offsets.size());
+}
+
+bool PostgresStreamState::ReceiveBatch(PostgresRowBatch &batch) {
+	lock_guard<mutex> stream_lock(lock);
+	if (finished) {
+		return false;
+	}
+	try {
+		if (!reader) {
+			auto &connection = receiver->connection;
+			reader = make_uniq<PostgresBinaryReader>(connection);
+			if (parameters) {
+				if (!receiver->setup_sql.empty()) {
+					connection.Execute(receiver->setup_sql);
+				}
+				connection.SendQueryParams(receiver->sql, *parameters);
+				reader->read_query_result = true;
 			} else {
-				reader.ReadValue(bind_data.types[col_idx], bind_data.postgres_types[col_idx], out_vec, output_offset);
+				connection.BeginCopyFrom(*reader, receiver->setup_sql + receiver->sql);
 			}
 		}
-		reader.Reset();
-		output_offset++;
+		// copy the rows into the batch so that the next batch can be received while this one is being decoded
+		while (batch.offsets.size() < STANDARD_VECTOR_SIZE) {
+			if (!reader->Ready() && !reader->Next()) {
+				reader->CheckResult();
+				finished = true;
+				break;
+			}
+			auto tuple_count = reader->ReadInteger<int16_t>();
+			if (tuple_count > 0) {
+				batch.offsets.push_back(batch.data.size());
+				batch.data.append(const_char_ptr_cast(reader->Position()), reader->RemainingBytes());
+			}
+			reader->Reset();
+		}
+	} catch (...) {
+		finished = true;
+		throw;
 	}
+	if (batch.offsets.empty()) {
+		return false;
+	}
+	batch.batch_idx = next_batch_idx++;
+	return true;
 }
 
 static void PostgresScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
@@ -477,8 +1259,21 @@ static void PostgresScan(ClientContext &context, TableFunctionInput &data, DataC
 		gstate.collection->Scan(gstate.scan_state, output);
 		return;
 	}
+	if (gstate.shared_scan) {
+		PostgresScanShared(gstate, output);
+		return;
+	}
+	if (gstate.replica) {
+		PostgresScanReplica(gstate, output);
+		return;
+	}
 	auto &local_state = data.local_state->Cast<PostgresLocalState>();
-	if (local_state.no_connection) {
+	if (gstate.stream) {
+		local_state.ScanBatch(bind_data, gstate, output);
+		return;
+	}
+	if (local_state.no_connection && !gstate.TryJoinScan(context, local_state, bind_data)) {
+		// the connection pool is exhausted and no connection freed up while there were tasks left
 		return;
 	}
 	local_state.ScanChunk(context, bind_data, gstate, output);
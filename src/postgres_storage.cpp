@@ -2,6 +2,7 @@
 
 #include "postgres_storage.hpp"
 #include "storage/postgres_catalog.hpp"
+#include "storage/postgres_replica_cache.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
 #include "storage/postgres_transaction_manager.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
@@ -52,6 +53,13 @@ unique_ptr<SecretEntry> GetSecret(ClientContext &context, const string &secret_n
 	return nullptr;
 }
 
+static string AddKeepaliveOptions(const string &connection_string, idx_t keepalive) {
+	// let the kernel probe idle connections - so that NATs and firewalls do not silently drop pooled connections
+	auto keepalive_options = StringUtil::Format("keepalives=1 keepalives_idle=%llu keepalives_interval=%llu", keepalive,
+	                                            keepalive);
+	return PostgresUtils::AddConnectionOptions(connection_string, keepalive_options);
+}
+
 static unique_ptr<Catalog> PostgresAttach(StorageExtensionInfo *storage_info, ClientContext &context,
                                           AttachedDatabase &db, const string &name, AttachInfo &info,
                                           AccessMode access_mode) {
@@ -59,6 +67,10 @@ static unique_ptr<Catalog> PostgresAttach(StorageExtensionInfo *storage_info, Cl
 
 	string secret_name;
 	string schema_to_load;
+	string cache_path;
+	string cache_append_key;
+	PostgresExplicitPoolOptions pool_options;
+	idx_t keepalive = 0;
 	for (auto &entry : info.options) {
 		auto lower_name = StringUtil::Lower(entry.first);
 		if (lower_name == "type" || lower_name == "read_only") {
@@ -67,6 +79,18 @@ static unique_ptr<Catalog> PostgresAttach(StorageExtensionInfo *storage_info, Cl
 			secret_name = entry.second.ToString();
 		} else if (lower_name == "schema") {
 			schema_to_load = entry.second.ToString();
+		} else if (lower_name == "cache") {
+			cache_path = entry.second.ToString();
+		} else if (lower_name == "cache_append_key") {
+			cache_append_key = entry.second.ToString();
+		} else if (lower_name == "pool_min_size") {
+			pool_options.minimum_connections = UBigIntValue::Get(entry.second.DefaultCastAs(LogicalType::UBIGINT));
+		} else if (lower_name == "pool_idle_timeout") {
+			pool_options.idle_timeout = UBigIntValue::Get(entry.second.DefaultCastAs(LogicalType::UBIGINT));
+		} else if (lower_name == "pool_max_lifetime") {
+			pool_options.max_lifetime = UBigIntValue::Get(entry.second.DefaultCastAs(LogicalType::UBIGINT));
+		} else if (lower_name == "pool_keepalive") {
+			keepalive = UBigIntValue::Get(entry.second.DefaultCastAs(LogicalType::UBIGINT));
 		} else {
 			throw BinderException("Unrecognized option for Postgres attach: %s", entry.first);
 		}
@@ -96,7 +120,24 @@ static unique_ptr<Catalog> PostgresAttach(StorageExtensionInfo *storage_info, Cl
 		// secret not found and one was explicitly provided - throw an error
 		throw BinderException("Secret with name \"%s\" not found", secret_name);
 	}
-	return make_uniq<PostgresCatalog>(db, connection_string, access_mode, std::move(schema_to_load));
+	if (cache_path.empty() && !cache_append_key.empty()) {
+		throw BinderException("CACHE_APPEND_KEY can only be used together with CACHE");
+	}
+	if (keepalive > 0) {
+		connection_string = AddKeepaliveOptions(connection_string, keepalive);
+	}
+	auto catalog = make_uniq<PostgresCatalog>(db, connection_string, access_mode, std::move(schema_to_load));
+	if (!cache_path.empty()) {
+		// the local database is bound by the same memory limit and amount of threads as the session
+		auto &config = DBConfig::GetConfig(context);
+		DBConfig cache_config;
+		cache_config.options.maximum_memory = config.options.maximum_memory;
+		cache_config.options.maximum_threads = config.options.maximum_threads;
+		catalog->SetReplicaCache(
+		    make_uniq<PostgresReplicaCache>(cache_path, std::move(cache_append_key), cache_config));
+	}
+	catalog->GetConnectionPool().SetExplicitOptions(pool_options);
+	return std::move(catalog);
 }
 
 static unique_ptr<TransactionManager> PostgresCreateTransactionManager(StorageExtensionInfo *storage_info,
@@ -0,0 +1,789 @@
+#include "duckdb.hpp"
+
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/main/appender.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "postgres_scanner.hpp"
+#include "storage/postgres_catalog.hpp"
+#include "storage/postgres_table_entry.hpp"
+
+namespace duckdb {
+
+//! The maximum amount of decoded changes that are applied to the local table at once
+static constexpr idx_t POSTGRES_SYNC_BATCH_SIZE = 100000;
+
+struct PostgresSyncBindData : public TableFunctionData {
+	string dsn;
+	PostgresVersion version;
+	//! The Postgres table that is synchronized
+	string schema_name;
+	string table_name;
+	vector<string> postgres_names;
+	vector<PostgresType> postgres_types;
+	//! The columns of the local table
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The local table that is synchronized into
+	string target_schema;
+	string target_table;
+	//! The path of the local database (empty for in-memory databases)
+	string database_path;
+	//! The logical replication slot that tracks the changes that have not been applied yet
+	string slot_name;
+	bool finished = false;
+
+	string GetTarget() const {
+		return KeywordHelper::WriteQuoted(target_schema, '"') + "." + KeywordHelper::WriteQuoted(target_table, '"');
+	}
+	string GetSource() const {
+		return KeywordHelper::WriteQuoted(schema_name, '"') + "." + KeywordHelper::WriteQuoted(table_name, '"');
+	}
+	//! The local table that records which replication slot synchronizes which table into which target
+	string GetMetadataTable() const {
+		return KeywordHelper::WriteQuoted(target_schema, '"') + ".__postgres_sync";
+	}
+};
+
+//! A decoded column value, as emitted by the test_decoding output plugin
+struct PostgresDecodedValue {
+	string name;
+	string value;
+	bool is_null = false;
+	//! The value was not changed and is not part of the change (TOAST)
+	bool unchanged_toast = false;
+};
+
+//! The pending change to a single row of the local table
+struct PostgresSyncRowChange {
+	bool deleted = false;
+	vector<string> key;
+	vector<Value> values;
+};
+
+struct PostgresSyncState {
+	PostgresSyncState(PostgresSyncBindData &data, Connection &con) : data(data), con(con) {
+	}
+
+	PostgresSyncBindData &data;
+	Connection &con;
+	//! The columns of the primary key of the table
+	vector<idx_t> key_columns;
+	//! Maps Postgres column names to local columns
+	case_insensitive_map_t<idx_t> column_map;
+	//! The pending changes, keyed on the primary key of the row
+	unordered_map<string, idx_t> change_map;
+	vector<PostgresSyncRowChange> changes;
+	idx_t upserted_rows = 0;
+	idx_t deleted_rows = 0;
+
+public:
+	void Upsert(vector<string> key, vector<Value> values);
+	void Delete(vector<string> key);
+	optional_ptr<PostgresSyncRowChange> GetChange(const vector<string> &key);
+	void Flush();
+	void Truncate();
+	void Update(const vector<string> &key, const vector<PostgresDecodedValue> &tuple);
+
+private:
+	void Execute(const string &query);
+	string GetKeyCondition(const vector<string> &key);
+};
+
+static string GetChangeKey(const vector<string> &key) {
+	string result;
+	for (auto &entry : key) {
+		result += entry;
+		result += '\0';
+	}
+	return result;
+}
+
+static string PostgresSyncCast(const string &expression, const LogicalType &type) {
+	if (type.id() == LogicalTypeId::BLOB) {
+		// bytea is emitted in the hex format (\x0123...)
+		return "from_hex(substr(" + expression + ", 3))";
+	}
+	return "CAST(" + expression + " AS " + type.ToString() + ")";
+}
+
+static string PostgresSyncLiteral(const Value &value, const LogicalType &type) {
+	if (value.IsNull()) {
+		return "NULL";
+	}
+	return PostgresSyncCast(KeywordHelper::WriteQuoted(StringValue::Get(value), '\''), type);
+}
+
+void PostgresSyncState::Execute(const string &query) {
+	auto result = con.Query(query);
+	if (result->HasError()) {
+		result->ThrowError("Failed to apply changes in postgres_sync: ");
+	}
+}
+
+optional_ptr<PostgresSyncRowChange> PostgresSyncState::GetChange(const vector<string> &key) {
+	auto entry = change_map.find(GetChangeKey(key));
+	if (entry == change_map.end()) {
+		return nullptr;
+	}
+	return &changes[entry->second];
+}
+
+void PostgresSyncState::Upsert(vector<string> key, vector<Value> values) {
+	auto change = GetChange(key);
+	if (!change) {
+		change_map[GetChangeKey(key)] = changes.size();
+		changes.emplace_back();
+		change = &changes.back();
+		change->key = std::move(key);
+	}
+	change->deleted = false;
+	change->values = std::move(values);
+}
+
+void PostgresSyncState::Delete(vector<string> key) {
+	auto change = GetChange(key);
+	if (!change) {
+		change_map[GetChangeKey(key)] = changes.size();
+		changes.emplace_back();
+		change = &changes.back();
+		change->key = std::move(key);
+	}
+	change->deleted = true;
+	change->values.clear();
+}
+
+string PostgresSyncState::GetKeyCondition(const vector<string> &key) {
+	string result;
+	for (idx_t k = 0; k < key_columns.size(); k++) {
+		auto column_idx = key_columns[k];
+		if (!result.empty()) {
+			result += " AND ";
+		}
+		result += KeywordHelper::WriteQuoted(data.names[column_idx], '"') + "=" +
+		          PostgresSyncLiteral(Value(key[k]), data.types[column_idx]);
+	}
+	return result;
+}
+
+void PostgresSyncState::Flush() {
+	if (changes.empty()) {
+		return;
+	}
+	// stage the keys of all changed rows and the new contents of the rows as text
+	Execute("DELETE FROM __postgres_sync_keys");
+	Execute("DELETE FROM __postgres_sync_rows");
+	{
+		Appender key_appender(con, "__postgres_sync_keys");
+		Appender row_appender(con, "__postgres_sync_rows");
+		for (auto &change : changes) {
+			key_appender.BeginRow();
+			for (auto &key : change.key) {
+				key_appender.Append<Value>(Value(key));
+			}
+			key_appender.EndRow();
+			if (change.deleted) {
+				deleted_rows++;
+				continue;
+			}
+			row_appender.BeginRow();
+			for (auto &value : change.values) {
+				row_appender.Append<Value>(value);
+			}
+			row_appender.EndRow();
+			upserted_rows++;
+		}
+		key_appender.Close();
+		row_appender.Close();
+	}
+	// apply the changes as a merge - delete all changed rows, and insert their new contents
+	string key_condition;
+	for (idx_t k = 0; k < key_columns.size(); k++) {
+		auto column_idx = key_columns[k];
+		if (!key_condition.empty()) {
+			key_condition += " AND ";
+		}
+		auto key_value = PostgresSyncCast("__postgres_sync_keys.k" + to_string(k), data.types[column_idx]);
+		key_condition += StringUtil::Format("%s.%s=%s", data.GetTarget(),
+		                                    KeywordHelper::WriteQuoted(data.names[column_idx], '"'), key_value);
+	}
+	Execute(StringUtil::Format("DELETE FROM %s USING __postgres_sync_keys WHERE %s", data.GetTarget(), key_condition));
+	string select_list;
+	for (idx_t c = 0; c < data.types.size(); c++) {
+		if (!select_list.empty()) {
+			select_list += ", ";
+		}
+		select_list += PostgresSyncCast("c" + to_string(c), data.types[c]);
+	}
+	Execute(StringUtil::Format("INSERT INTO %s SELECT %s FROM __postgres_sync_rows", data.GetTarget(), select_list));
+	changes.clear();
+	change_map.clear();
+}
+
+void PostgresSyncState::Truncate() {
+	changes.clear();
+	change_map.clear();
+	Execute("DELETE FROM " + data.GetTarget());
+}
+
+void PostgresSyncState::Update(const vector<string> &key, const vector<PostgresDecodedValue> &tuple) {
+	// the update only contains some of the columns - apply it directly to the local table
+	Flush();
+	string set_list;
+	for (auto &column : tuple) {
+		if (column.unchanged_toast) {
+			continue;
+		}
+		auto column_idx = column_map[column.name];
+		if (!set_list.empty()) {
+			set_list += ", ";
+		}
+		set_list += KeywordHelper::WriteQuoted(data.names[column_idx], '"') + "=" +
+		            PostgresSyncLiteral(column.is_null ? Value() : Value(column.value), data.types[column_idx]);
+	}
+	Execute(StringUtil::Format("UPDATE %s SET %s WHERE %s", data.GetTarget(), set_list, GetKeyCondition(key)));
+	upserted_rows++;
+}
+
+//! Parses a (possibly quoted) identifier
+static string ParseIdentifier(const string &data, idx_t &pos) {
+	string result;
+	if (pos < data.size() && data[pos] == '"') {
+		pos++;
+		while (pos < data.size()) {
+			if (data[pos] == '"') {
+				if (pos + 1 < data.size() && data[pos + 1] == '"') {
+					result += '"';
+					pos += 2;
+					continue;
+				}
+				pos++;
+				break;
+			}
+			result += data[pos++];
+		}
+		return result;
+	}
+	while (pos < data.size() && data[pos] != '[') {
+		result += data[pos++];
+	}
+	return result;
+}
+
+//! Parses a tuple of the form ' name[type]:value name[type]:value ...'
+//! Parsing stops at the end of the data or at " new-tuple:"
+static vector<PostgresDecodedValue> ParseTuple(const string &data, idx_t &pos) {
+	static const string NEW_TUPLE = " new-tuple:";
+	static const string UNCHANGED_TOAST = "unchanged-toast-datum";
+	vector<PostgresDecodedValue> result;
+	while (pos < data.size() && data.compare(pos, NEW_TUPLE.size(), NEW_TUPLE) != 0) {
+		if (data[pos] != ' ') {
+			throw IOException("Failed to parse decoded change \"%s\": expected a space at position %d", data, pos);
+		}
+		pos++;
+		PostgresDecodedValue value;
+		value.name = ParseIdentifier(data, pos);
+		// skip the type - the type name can contain brackets (e.g. integer[])
+		auto type_end = data.find("]:", pos);
+		if (pos >= data.size() || data[pos] != '[' || type_end == string::npos) {
+			throw IOException("Failed to parse decoded change \"%s\": expected a type at position %d", data, pos);
+		}
+		pos = type_end + 2;
+		if (data.compare(pos, 4, "null") == 0 && (pos + 4 == data.size() || data[pos + 4] == ' ')) {
+			value.is_null = true;
+			pos += 4;
+		} else if (data.compare(pos, UNCHANGED_TOAST.size(), UNCHANGED_TOAST) == 0) {
+			value.unchanged_toast = true;
+			pos += UNCHANGED_TOAST.size();
+		} else if (pos < data.size() && (data[pos] == '\'' || data[pos] == 'B')) {
+			// quoted literal - quotes are escaped by doubling them
+			if (data[pos] == 'B') {
+				pos++;
+			}
+			pos++;
+			while (pos < data.size()) {
+				if (data[pos] == '\'') {
+					if (pos + 1 < data.size() && data[pos + 1] == '\'') {
+						value.value += '\'';
+						pos += 2;
+						continue;
+					}
+					pos++;
+					break;
+				}
+				value.value += data[pos++];
+			}
+		} else {
+			// unquoted literal (numbers and booleans)
+			while (pos < data.size() && data[pos] != ' ') {
+				value.value += data[pos++];
+			}
+		}
+		result.push_back(std::move(value));
+	}
+	return result;
+}
+
+static vector<string> GetRowKey(PostgresSyncState &state, const vector<PostgresDecodedValue> &tuple) {
+	vector<string> key;
+	key.resize(state.key_columns.size());
+	vector<bool> found(state.key_columns.size(), false);
+	for (auto &column : tuple) {
+		auto entry = state.column_map.find(column.name);
+		if (entry == state.column_map.end()) {
+			continue;
+		}
+		for (idx_t k = 0; k < state.key_columns.size(); k++) {
+			if (state.key_columns[k] == entry->second) {
+				key[k] = column.value;
+				found[k] = true;
+			}
+		}
+	}
+	for (idx_t k = 0; k < found.size(); k++) {
+		if (!found[k]) {
+			throw IOException("Decoded change for table \"%s\" is missing primary key column \"%s\"",
+			                  state.data.table_name, state.data.postgres_names[state.key_columns[k]]);
+		}
+	}
+	return key;
+}
+
+static bool HasUnchangedToast(const vector<PostgresDecodedValue> &tuple) {
+	for (auto &column : tuple) {
+		if (column.unchanged_toast) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static vector<Value> GetRowValues(PostgresSyncState &state, const vector<PostgresDecodedValue> &tuple) {
+	vector<Value> values(state.data.types.size(), Value());
+	for (auto &column : tuple) {
+		auto entry = state.column_map.find(column.name);
+		if (entry == state.column_map.end()) {
+			throw IOException("Decoded change for table \"%s\" contains unknown column \"%s\" - the table was altered, "
+			                  "drop the local table to synchronize it from scratch",
+			                  state.data.table_name, column.name);
+		}
+		if (!column.is_null) {
+			values[entry->second] = Value(column.value);
+		}
+	}
+	return values;
+}
+
+//! Parses a table name as emitted by test_decoding (schema.table - both quoted only if required)
+static bool ParseQualifiedName(const string &data, idx_t &pos, string &name) {
+	auto start = pos;
+	for (idx_t part = 0; part < 2; part++) {
+		if (part > 0) {
+			if (pos >= data.size() || data[pos] != '.') {
+				return false;
+			}
+			pos++;
+		}
+		if (pos < data.size() && data[pos] == '"') {
+			// quoted identifier - quotes are escaped by doubling them
+			pos++;
+			while (true) {
+				if (pos >= data.size()) {
+					return false;
+				}
+				if (data[pos] == '"') {
+					if (pos + 1 < data.size() && data[pos + 1] == '"') {
+						pos += 2;
+						continue;
+					}
+					pos++;
+					break;
+				}
+				pos++;
+			}
+		} else {
+			auto identifier_start = pos;
+			while (pos < data.size() && (StringUtil::CharacterIsAlphaNumeric(data[pos]) || data[pos] == '_' ||
+			                             data[pos] == '$')) {
+				pos++;
+			}
+			if (pos == identifier_start) {
+				return false;
+			}
+		}
+	}
+	name = data.substr(start, pos - start);
+	return true;
+}
+
+//! Applies a single change emitted by the test_decoding output plugin
+static void ApplyDecodedChange(PostgresSyncState &state, const string &table_prefix, const string &qualified_name,
+                               const string &data) {
+	static const string TRUNCATE = ": TRUNCATE:";
+	if (StringUtil::StartsWith(data, "table ")) {
+		// "table a, b: TRUNCATE: (no-flags)" - the list of tables is parsed, so that values of other changes that
+		// contain ": TRUNCATE:" are not mistaken for a truncate
+		idx_t pos = 6;
+		vector<string> tables;
+		string name;
+		while (ParseQualifiedName(data, pos, name)) {
+			tables.push_back(std::move(name));
+			if (data.compare(pos, 2, ", ") != 0) {
+				break;
+			}
+			pos += 2;
+		}
+		if (!tables.empty() && data.compare(pos, TRUNCATE.size(), TRUNCATE) == 0) {
+			for (auto &table : tables) {
+				if (table == qualified_name) {
+					state.Truncate();
+					return;
+				}
+			}
+			return;
+		}
+	}
+	if (!StringUtil::StartsWith(data, table_prefix)) {
+		// BEGIN/COMMIT or a change of another table
+		return;
+	}
+	idx_t pos = table_prefix.size();
+	if (data.compare(pos, 7, "INSERT:") == 0) {
+		pos += 7;
+		auto tuple = ParseTuple(data, pos);
+		state.Upsert(GetRowKey(state, tuple), GetRowValues(state, tuple));
+	} else if (data.compare(pos, 7, "UPDATE:") == 0) {
+		pos += 7;
+		vector<PostgresDecodedValue> old_tuple;
+		static const string OLD_KEY = " old-key:";
+		if (data.compare(pos, OLD_KEY.size(), OLD_KEY) == 0) {
+			// the key of the row has changed
+			pos += OLD_KEY.size();
+			old_tuple = ParseTuple(data, pos);
+			pos += string(" new-tuple:").size();
+		}
+		auto tuple = ParseTuple(data, pos);
+		auto new_key = GetRowKey(state, tuple);
+		auto old_key = old_tuple.empty() ? new_key : GetRowKey(state, old_tuple);
+		if (!HasUnchangedToast(tuple)) {
+			if (old_key != new_key) {
+				state.Delete(old_key);
+			}
+			state.Upsert(std::move(new_key), GetRowValues(state, tuple));
+			return;
+		}
+		// unchanged TOAST values are not emitted - merge the change into the pending row if there is one
+		auto change = state.GetChange(old_key);
+		if (change && !change->deleted) {
+			auto values = change->values;
+			for (auto &column : tuple) {
+				if (!column.unchanged_toast) {
+					values[state.column_map[column.name]] = column.is_null ? Value() : Value(column.value);
+				}
+			}
+			if (old_key != new_key) {
+				state.Delete(old_key);
+			}
+			state.Upsert(std::move(new_key), std::move(values));
+			return;
+		}
+		state.Update(old_key, tuple);
+	} else if (data.compare(pos, 7, "DELETE:") == 0) {
+		pos += 7;
+		if (data.compare(pos, 16, " (no-tuple-data)") == 0) {
+			throw IOException("Decoded DELETE of table \"%s\" does not contain the primary key - set the REPLICA "
+			                  "IDENTITY of the table to DEFAULT",
+			                  state.data.table_name);
+		}
+		auto tuple = ParseTuple(data, pos);
+		state.Delete(GetRowKey(state, tuple));
+	}
+}
+
+//! Replication slot names may only contain lower case letters, numbers and underscores
+static string PostgresSyncSlotName(const string &name) {
+	auto result = StringUtil::Lower(name);
+	for (auto &c : result) {
+		if (!StringUtil::CharacterIsAlphaNumeric(c) && c != '_') {
+			c = '_';
+		}
+	}
+	return result;
+}
+
+static unique_ptr<FunctionData> PostgresSyncBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_uniq<PostgresSyncBindData>();
+	auto &table = PostgresTableEntry::Lookup(context, "postgres_sync", input.inputs[0].GetValue<string>());
+	auto &pg_catalog = table.catalog.Cast<PostgresCatalog>();
+	result->dsn = pg_catalog.path;
+	result->version = pg_catalog.GetPostgresVersion();
+	result->schema_name = table.schema.name;
+	result->table_name = table.name;
+	result->postgres_names = table.postgres_names;
+	result->postgres_types = table.postgres_types;
+	for (auto &col : table.GetColumns().Logical()) {
+		switch (col.GetType().InternalType()) {
+		case PhysicalType::LIST:
+		case PhysicalType::STRUCT:
+		case PhysicalType::ARRAY:
+			throw BinderException("postgres_sync does not support column \"%s\" of type %s", col.GetName(),
+			                      col.GetType().ToString());
+		default:
+			break;
+		}
+		result->names.push_back(col.GetName());
+		// enums are aliased with the name of the Postgres type - which does not exist in the local database
+		result->types.push_back(PostgresUtils::RemoveAlias(col.GetType()));
+	}
+	// the target is "table" or "schema.table"
+	auto target = input.inputs[1].GetValue<string>();
+	auto target_parts = StringUtil::SplitWithQuote(target, '.');
+	if (target_parts.empty() || target_parts.size() > 2) {
+		throw BinderException("postgres_sync: target \"%s\" must be of the form table or schema.table", target);
+	}
+	result->target_schema = target_parts.size() == 2 ? target_parts[0] : string(DEFAULT_SCHEMA);
+	result->target_table = target_parts.back();
+
+	auto entry = input.named_parameters.find("slot_name");
+	if (entry != input.named_parameters.end()) {
+		result->slot_name = PostgresSyncSlotName(entry->second.GetValue<string>());
+	}
+	// the slot is created by the first call - the slot name defaults to a name that is unique to the local database
+	auto &database_path = DBConfig::GetConfig(context).options.database_path;
+	if (database_path != ":memory:") {
+		result->database_path = database_path;
+	}
+
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("mode");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("upserted_rows");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("deleted_rows");
+	return std::move(result);
+}
+
+static void CheckResult(QueryResult &result) {
+	if (result.HasError()) {
+		result.ThrowError("Failed to synchronize Postgres table: ");
+	}
+}
+
+static vector<idx_t> GetPrimaryKey(PostgresConnection &con, PostgresSyncBindData &data) {
+	auto table_name =
+	    KeywordHelper::WriteQuoted(data.schema_name, '"') + "." + KeywordHelper::WriteQuoted(data.table_name, '"');
+	auto result = con.Query(StringUtil::Format(
+	    "SELECT a.attname FROM pg_index i JOIN pg_attribute a ON a.attrelid = i.indrelid AND a.attnum = ANY(i.indkey) "
+	    "WHERE i.indrelid = %s::regclass AND i.indisprimary",
+	    KeywordHelper::WriteQuoted(table_name, '\'')));
+	vector<idx_t> key_columns;
+	for (idx_t row = 0; row < result->Count(); row++) {
+		auto column_name = result->GetString(row, 0);
+		for (idx_t c = 0; c < data.postgres_names.size(); c++) {
+			if (data.postgres_names[c] == column_name) {
+				key_columns.push_back(c);
+			}
+		}
+	}
+	if (key_columns.empty()) {
+		throw BinderException("postgres_sync requires table \"%s\" to have a primary key", data.table_name);
+	}
+	return key_columns;
+}
+
+//! Creates the replication slot and copies the table using the snapshot exported by the slot
+//! Changes made after the snapshot are retained in the slot and applied by the next call
+static idx_t PostgresSyncInitial(PostgresSyncBindData &data, PostgresConnection &pg_con, Connection &con) {
+	auto replication_con =
+	    PostgresConnection::Open(PostgresUtils::AddConnectionOptions(data.dsn, "replication=database"));
+	auto slot = replication_con.Query(
+	    StringUtil::Format("CREATE_REPLICATION_SLOT %s LOGICAL test_decoding EXPORT_SNAPSHOT", data.slot_name));
+	auto snapshot = slot->GetString(0, 2);
+
+	idx_t row_count;
+	try {
+		// the snapshot remains valid as long as the replication connection is not used
+		pg_con.Execute("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY");
+		pg_con.Query(StringUtil::Format("SET TRANSACTION SNAPSHOT '%s'", snapshot));
+
+		auto columns = PostgresUtils::GetColumnDefinitions(data.names, data.types);
+		auto col_names = PostgresUtils::GetCopyColumnList(data.postgres_names, data.postgres_types);
+		con.BeginTransaction();
+		CheckResult(*con.Query(StringUtil::Format("CREATE OR REPLACE TABLE %s(%s)", data.GetTarget(), columns)));
+		Appender appender(con, data.target_schema, data.target_table);
+		row_count = pg_con.CopyFrom(StringUtil::Format("COPY (SELECT %s FROM %s) TO STDOUT (FORMAT binary)", col_names,
+		                                               data.GetSource()),
+		                            data.types, data.postgres_types, appender);
+		appender.Close();
+		// record that the slot belongs to this source and target - in the same transaction as the copy
+		auto statement = con.Prepare(StringUtil::Format("INSERT OR REPLACE INTO %s VALUES ($1, $2, $3)",
+		                                                data.GetMetadataTable()));
+		CheckResult(*statement->Execute(data.slot_name, data.GetSource(), data.GetTarget()));
+		con.Commit();
+		pg_con.Execute("COMMIT");
+	} catch (...) {
+		// the slot retains WAL until it is dropped - do not leave it behind when the initial copy fails
+		if (con.HasActiveTransaction()) {
+			con.Rollback();
+		}
+		replication_con.Close();
+		pg_con.TryQuery("ROLLBACK");
+		pg_con.TryQuery(StringUtil::Format("SELECT pg_drop_replication_slot(%s)",
+		                                   KeywordHelper::WriteQuoted(data.slot_name, '\'')));
+		throw;
+	}
+	return row_count;
+}
+
+//! Applies the changes that have been retained in the replication slot since the previous call
+static void PostgresSyncChanges(PostgresSyncState &state, PostgresConnection &pg_con) {
+	auto &data = state.data;
+	auto &con = state.con;
+	auto qualified_name = pg_con
+	                          .Query(StringUtil::Format("SELECT quote_ident(%s) || '.' || quote_ident(%s)",
+	                                                    KeywordHelper::WriteQuoted(data.schema_name, '\''),
+	                                                    KeywordHelper::WriteQuoted(data.table_name, '\'')))
+	                          ->GetString(0, 0);
+	auto table_prefix = "table " + qualified_name + ": ";
+
+	// changes are staged as text in temporary tables
+	string key_columns;
+	for (idx_t k = 0; k < state.key_columns.size(); k++) {
+		key_columns += (k > 0 ? ", k" : "k") + to_string(k) + " VARCHAR";
+	}
+	string row_columns;
+	for (idx_t c = 0; c < data.types.size(); c++) {
+		row_columns += (c > 0 ? ", c" : "c") + to_string(c) + " VARCHAR";
+	}
+	CheckResult(*con.Query("CREATE OR REPLACE TEMPORARY TABLE __postgres_sync_keys(" + key_columns + ")"));
+	CheckResult(*con.Query("CREATE OR REPLACE TEMPORARY TABLE __postgres_sync_rows(" + row_columns + ")"));
+
+	auto slot_name = KeywordHelper::WriteQuoted(data.slot_name, '\'');
+	while (true) {
+		// peek at the changes - they are only consumed once they have been applied to the local table
+		auto result = pg_con.Query(StringUtil::Format(
+		    "SELECT lsn::VARCHAR, data FROM pg_logical_slot_peek_changes(%s, NULL, %d, 'include-xids', '0', "
+		    "'skip-empty-xacts', '1')",
+		    slot_name, POSTGRES_SYNC_BATCH_SIZE));
+		if (result->Count() == 0) {
+			break;
+		}
+		con.BeginTransaction();
+		for (idx_t row = 0; row < result->Count(); row++) {
+			ApplyDecodedChange(state, table_prefix, qualified_name, result->GetString(row, 1));
+		}
+		state.Flush();
+		con.Commit();
+		// consume the applied changes - advancing the slot does not decode the changes a second time
+		auto last_lsn = result->GetString(result->Count() - 1, 0);
+		pg_con.Query(StringUtil::Format("SELECT pg_replication_slot_advance(%s, '%s'::pg_lsn)", slot_name, last_lsn));
+	}
+	CheckResult(*con.Query("DROP TABLE __postgres_sync_keys"));
+	CheckResult(*con.Query("DROP TABLE __postgres_sync_rows"));
+}
+
+//! Returns the default name of the replication slot - slots are shared by all clients of the server, so the name
+//! is unique to the source, the target and the local database (in-memory databases get a random name)
+static string PostgresSyncDefaultSlotName(const PostgresSyncBindData &data) {
+	auto database = data.database_path.empty() ? UUID::ToString(UUID::GenerateRandomUUID()) : data.database_path;
+	auto key = data.dsn + "|" + data.GetSource() + "|" + database + "|" + data.GetTarget();
+	auto hash = Hash(key.c_str(), key.size());
+	string result = "duckdb_sync_";
+	for (idx_t i = 0; i < 16; i++) {
+		result += "0123456789abcdef"[(hash >> ((15 - i) * 4)) & 0xF];
+	}
+	return result;
+}
+
+//! Determines the replication slot of the sync - returns whether or not this sync created the slot
+//! Slots that are recorded for a different source or target are refused
+static bool PostgresSyncResolveSlot(PostgresSyncBindData &data, Connection &con) {
+	auto metadata_table = data.GetMetadataTable();
+	CheckResult(*con.Query(StringUtil::Format(
+	    "CREATE TABLE IF NOT EXISTS %s(slot_name VARCHAR PRIMARY KEY, source VARCHAR, target VARCHAR)",
+	    metadata_table)));
+	if (data.slot_name.empty()) {
+		// reuse the slot of the previous sync of the same source and target
+		auto statement = con.Prepare(
+		    StringUtil::Format("SELECT slot_name FROM %s WHERE source = $1 AND target = $2", metadata_table));
+		auto result = statement->Execute(data.GetSource(), data.GetTarget());
+		CheckResult(*result);
+		auto &previous = result->Cast<MaterializedQueryResult>();
+		data.slot_name =
+		    previous.RowCount() > 0 ? previous.GetValue(0, 0).ToString() : PostgresSyncDefaultSlotName(data);
+	}
+	auto statement =
+	    con.Prepare(StringUtil::Format("SELECT source, target FROM %s WHERE slot_name = $1", metadata_table));
+	auto result = statement->Execute(data.slot_name);
+	CheckResult(*result);
+	auto &owner = result->Cast<MaterializedQueryResult>();
+	if (owner.RowCount() == 0) {
+		return false;
+	}
+	auto source = owner.GetValue(0, 0).ToString();
+	auto target = owner.GetValue(1, 0).ToString();
+	if (source != data.GetSource() || target != data.GetTarget()) {
+		throw InvalidInputException("postgres_sync: replication slot \"%s\" is used to synchronize %s into %s",
+		                            data.slot_name, source, target);
+	}
+	return true;
+}
+
+static void PGSyncFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<PostgresSyncBindData>();
+	if (data.finished) {
+		return;
+	}
+	data.finished = true;
+	if (data.version < PostgresVersion(11, 0, 0)) {
+		throw NotImplementedException("postgres_sync requires PostgreSQL 11 or higher");
+	}
+	// the local table is written through a separate connection - the changes are committed immediately
+	Connection con(*context.db);
+	PostgresSyncState state(data, con);
+	auto pg_con = PostgresConnection::Open(data.dsn);
+	state.key_columns = GetPrimaryKey(pg_con, data);
+	for (idx_t c = 0; c < data.postgres_names.size(); c++) {
+		state.column_map[data.postgres_names[c]] = c;
+	}
+
+	auto owns_slot = PostgresSyncResolveSlot(data, con);
+	auto slot = pg_con.Query(StringUtil::Format("SELECT 1 FROM pg_replication_slots WHERE slot_name = %s",
+	                                            KeywordHelper::WriteQuoted(data.slot_name, '\'')));
+	bool has_slot = slot->Count() > 0;
+	bool has_target = con.TableInfo(data.target_schema, data.target_table) != nullptr;
+	if (has_slot && !owns_slot) {
+		// the slot was not created for this target - consuming or dropping it would lose the changes of its owner
+		throw InvalidInputException("postgres_sync: replication slot \"%s\" already exists, but was not created to "
+		                            "synchronize %s into %s in this database - specify a different slot_name",
+		                            data.slot_name, data.GetSource(), data.GetTarget());
+	}
+	if (has_slot && has_target) {
+		PostgresSyncChanges(state, pg_con);
+		output.SetValue(0, 0, Value("incremental"));
+		output.SetValue(1, 0, Value::BIGINT(NumericCast<int64_t>(state.upserted_rows)));
+		output.SetValue(2, 0, Value::BIGINT(NumericCast<int64_t>(state.deleted_rows)));
+	} else {
+		if (has_slot) {
+			// the local table does not exist (anymore) - start from scratch
+			pg_con.Query(StringUtil::Format("SELECT pg_drop_replication_slot(%s)",
+			                                KeywordHelper::WriteQuoted(data.slot_name, '\'')));
+		}
+		auto row_count = PostgresSyncInitial(data, pg_con, con);
+		output.SetValue(0, 0, Value("initial"));
+		output.SetValue(1, 0, Value::BIGINT(NumericCast<int64_t>(row_count)));
+		output.SetValue(2, 0, Value::BIGINT(0));
+	}
+	output.SetCardinality(1);
+}
+
+PostgresSyncFunction::PostgresSyncFunction()
+    : TableFunction("postgres_sync", {LogicalType::VARCHAR, LogicalType::VARCHAR}, PGSyncFunction,
+                    PostgresSyncBind) {
+	named_parameters["slot_name"] = LogicalType::VARCHAR;
+}
+
+} // namespace duckdb
@@ -3,11 +3,24 @@
 #include "storage/postgres_transaction.hpp"
 #include "postgres_type_oids.hpp"
 
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
 namespace duckdb {
 
 static void PGNoticeProcessor(void *arg, const char *message) {
 }
 
+string PostgresUtils::AddConnectionOptions(const string &dsn, const string &options) {
+	if (StringUtil::StartsWith(dsn, "postgres://") || StringUtil::StartsWith(dsn, "postgresql://")) {
+		// URI connection strings take the options as query parameters
+		auto separator = dsn.find('?') == string::npos ? "?" : "&";
+		return dsn + separator + StringUtil::Replace(options, " ", "&");
+	}
+	return dsn + " " + options;
+}
+
 PGconn *PostgresUtils::PGConnect(const string &dsn) {
 	PGconn *conn = PQconnectdb(dsn.c_str());
 
@@ -19,6 +32,110 @@ PGconn *PostgresUtils::PGConnect(const string &dsn) {
 	return conn;
 }
 
+//! Returns the connect_timeout (in seconds) of a connection - or 0 if there is none
+static idx_t PGGetConnectTimeout(PGconn *conn) {
+	idx_t timeout = 0;
+	auto options = PQconninfo(conn);
+	if (!options) {
+		return timeout;
+	}
+	for (auto option = options; option->keyword; option++) {
+		if (strcmp(option->keyword, "connect_timeout") == 0 && option->val) {
+			auto value = atoi(option->val);
+			timeout = value > 0 ? MaxValue<idx_t>(NumericCast<idx_t>(value), 2) : 0;
+		}
+	}
+	PQconninfoFree(options);
+	return timeout;
+}
+
+vector<PGconn *> PostgresUtils::PGConnectConcurrently(const string &dsn, idx_t count) {
+	vector<PGconn *> connections;
+#ifdef _WIN32
+	// no poll() - open the connections one by one
+	try {
+		for (idx_t i = 0; i < count; i++) {
+			connections.push_back(PGConnect(dsn));
+		}
+	} catch (...) {
+		for (auto conn : connections) {
+			PQfinish(conn);
+		}
+		throw;
+	}
+	return connections;
+#else
+	try {
+		// start all connections, then drive the connection handshakes of all of them at the same time
+		vector<PostgresPollingStatusType> status;
+		for (idx_t i = 0; i < count; i++) {
+			auto conn = PQconnectStart(dsn.c_str());
+			if (!conn) {
+				throw IOException("Unable to connect to Postgres at %s: out of memory", dsn);
+			}
+			connections.push_back(conn);
+			status.push_back(PQstatus(conn) == CONNECTION_BAD ? PGRES_POLLING_FAILED : PGRES_POLLING_WRITING);
+		}
+		auto connect_timeout = connections.empty() ? 0 : PGGetConnectTimeout(connections[0]);
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(connect_timeout);
+		vector<pollfd> fds;
+		vector<idx_t> fd_connections;
+		while (true) {
+			fds.clear();
+			fd_connections.clear();
+			for (idx_t i = 0; i < connections.size(); i++) {
+				if (status[i] != PGRES_POLLING_READING && status[i] != PGRES_POLLING_WRITING) {
+					continue;
+				}
+				pollfd fd;
+				fd.fd = PQsocket(connections[i]);
+				fd.events = status[i] == PGRES_POLLING_READING ? POLLIN : POLLOUT;
+				fd.revents = 0;
+				fds.push_back(fd);
+				fd_connections.push_back(i);
+			}
+			if (fds.empty()) {
+				break;
+			}
+			int timeout_ms = -1;
+			if (connect_timeout > 0) {
+				auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+				    deadline - std::chrono::steady_clock::now());
+				timeout_ms = NumericCast<int>(MaxValue<int64_t>(remaining.count(), 0));
+			}
+			auto rc = poll(fds.data(), fds.size(), timeout_ms);
+			if (rc < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				throw IOException("Unable to connect to Postgres at %s: poll failed (%s)", dsn, strerror(errno));
+			}
+			if (rc == 0) {
+				throw IOException("Unable to connect to Postgres at %s: timeout expired", dsn);
+			}
+			for (idx_t i = 0; i < fds.size(); i++) {
+				if (fds[i].revents != 0) {
+					auto conn_idx = fd_connections[i];
+					status[conn_idx] = PQconnectPoll(connections[conn_idx]);
+				}
+			}
+		}
+		for (auto conn : connections) {
+			if (PQstatus(conn) != CONNECTION_OK) {
+				throw IOException("Unable to connect to Postgres at %s: %s", dsn, string(PQerrorMessage(conn)));
+			}
+			PQsetNoticeProcessor(conn, PGNoticeProcessor, nullptr);
+		}
+	} catch (...) {
+		for (auto conn : connections) {
+			PQfinish(conn);
+		}
+		throw;
+	}
+	return connections;
+#endif
+}
+
 string PostgresUtils::TypeToString(const LogicalType &input) {
 	if (input.HasAlias()) {
 		return input.GetAlias();
@@ -48,7 +165,11 @@ string PostgresUtils::TypeToString(const LogicalType &input) {
 }
 
 LogicalType PostgresUtils::RemoveAlias(const LogicalType &type) {
-	if (!type.HasAlias()) {
+	if (type.id() == LogicalTypeId::LIST) {
+		// arrays of enums or composite types
+		return LogicalType::LIST(RemoveAlias(ListType::GetChildType(type)));
+	}
+	if (!type.HasAlias() && type.id() != LogicalTypeId::STRUCT) {
 		return type;
 	}
 	if (StringUtil::CIEquals(type.GetAlias(), "json")) {
@@ -56,7 +177,10 @@ LogicalType PostgresUtils::RemoveAlias(const LogicalType &type) {
 	}
 	switch (type.id()) {
 	case LogicalTypeId::STRUCT: {
-		auto child_types = StructType::GetChildTypes(type);
+		child_list_t<LogicalType> child_types;
+		for (auto &child : StructType::GetChildTypes(type)) {
+			child_types.push_back(make_pair(child.first, RemoveAlias(child.second)));
+		}
 		return LogicalType::STRUCT(std::move(child_types));
 	}
 	case LogicalTypeId::ENUM: {
@@ -70,6 +194,32 @@ LogicalType PostgresUtils::RemoveAlias(const LogicalType &type) {
 	}
 }
 
+string PostgresUtils::GetColumnDefinitions(const vector<string> &names, const vector<LogicalType> &types) {
+	string result;
+	for (idx_t c = 0; c < types.size(); c++) {
+		if (!result.empty()) {
+			result += ", ";
+		}
+		result += KeywordHelper::WriteQuoted(names[c], '"') + " " + RemoveAlias(types[c]).ToString();
+	}
+	return result;
+}
+
+string PostgresUtils::GetCopyColumnList(const vector<string> &postgres_names,
+                                        const vector<PostgresType> &postgres_types) {
+	string result;
+	for (idx_t c = 0; c < postgres_names.size(); c++) {
+		if (!result.empty()) {
+			result += ", ";
+		}
+		result += KeywordHelper::WriteQuoted(postgres_names[c], '"');
+		if (postgres_types[c].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
+			result += "::VARCHAR";
+		}
+	}
+	return result;
+}
+
 LogicalType PostgresUtils::TypeToLogicalType(optional_ptr<PostgresTransaction> transaction,
                                              optional_ptr<PostgresSchemaEntry> schema,
                                              const PostgresTypeData &type_info, PostgresType &postgres_type) {
@@ -296,6 +446,7 @@ bool PostgresUtils::SupportedPostgresOid(const LogicalType &input) {
 	case LogicalTypeId::TIMESTAMP_TZ:
 	case LogicalTypeId::BIT:
 	case LogicalTypeId::UUID:
+	case LogicalTypeId::DECIMAL:
 		return true;
 	default:
 		return false;
@@ -425,6 +576,8 @@ uint32_t PostgresUtils::ToPostgresOid(const LogicalType &input) {
 		return BITOID;
 	case LogicalTypeId::UUID:
 		return UUIDOID;
+	case LogicalTypeId::DECIMAL:
+		return NUMERICOID;
 	case LogicalTypeId::LIST:
 		return PostgresUtils::ToPostgresOid(ListType::GetChildType(input));
 	default:
@@ -432,6 +585,106 @@ uint32_t PostgresUtils::ToPostgresOid(const LogicalType &input) {
 	}
 }
 
+bool PostgresUtils::TryGetPostgresOid(const LogicalType &input, const PostgresType &postgres_type, uint32_t &result) {
+	if (postgres_type.oid != 0) {
+		// oid was read from the catalog
+		result = uint32_t(postgres_type.oid);
+		return true;
+	}
+	switch (postgres_type.info) {
+	case PostgresTypeAnnotation::STANDARD:
+		break;
+	case PostgresTypeAnnotation::JSONB:
+		result = JSONBOID;
+		return true;
+	case PostgresTypeAnnotation::FIXED_LENGTH_CHAR:
+		result = BPCHAROID;
+		return true;
+	case PostgresTypeAnnotation::NUMERIC_AS_DOUBLE:
+		result = NUMERICOID;
+		return true;
+	case PostgresTypeAnnotation::GEOM_POINT:
+		result = POINTOID;
+		return true;
+	case PostgresTypeAnnotation::GEOM_LINE:
+		result = LINEOID;
+		return true;
+	case PostgresTypeAnnotation::GEOM_LINE_SEGMENT:
+		result = LSEGOID;
+		return true;
+	case PostgresTypeAnnotation::GEOM_BOX:
+		result = BOXOID;
+		return true;
+	case PostgresTypeAnnotation::GEOM_PATH:
+		result = PATHOID;
+		return true;
+	case PostgresTypeAnnotation::GEOM_POLYGON:
+		result = POLYGONOID;
+		return true;
+	case PostgresTypeAnnotation::GEOM_CIRCLE:
+		result = CIRCLEOID;
+		return true;
+	default:
+		return false;
+	}
+	if (input.id() == LogicalTypeId::VARCHAR && input.HasAlias() && StringUtil::CIEquals(input.GetAlias(), "json")) {
+		result = JSONOID;
+		return true;
+	}
+	// nested types and enums are user-defined types - we can only know their oid if they came from the catalog
+	if (input.id() == LogicalTypeId::LIST || !SupportedPostgresOid(input)) {
+		return false;
+	}
+	result = ToPostgresOid(input);
+	return true;
+}
+
+uint32_t PostgresUtils::ToPostgresOid(const LogicalType &input, const PostgresType &postgres_type) {
+	uint32_t result;
+	if (!TryGetPostgresOid(input, postgres_type, result)) {
+		throw NotImplementedException("Unsupported type for Postgres binary copy: %s", input.ToString());
+	}
+	return result;
+}
+
+bool PostgresUtils::IsPostgresArray(const LogicalType &input, const PostgresType &postgres_type) {
+	if (input.id() != LogicalTypeId::LIST) {
+		return false;
+	}
+	switch (postgres_type.info) {
+	case PostgresTypeAnnotation::GEOM_LINE:
+	case PostgresTypeAnnotation::GEOM_LINE_SEGMENT:
+	case PostgresTypeAnnotation::GEOM_BOX:
+	case PostgresTypeAnnotation::GEOM_PATH:
+	case PostgresTypeAnnotation::GEOM_POLYGON:
+	case PostgresTypeAnnotation::GEOM_CIRCLE:
+		return false;
+	default:
+		return true;
+	}
+}
+
+void PostgresUtils::SetPostgresOids(const LogicalType &input, PostgresType &postgres_type, idx_t type_oid,
+                                    idx_t element_oid) {
+	postgres_type.oid = type_oid;
+	if (element_oid == 0 || postgres_type.info != PostgresTypeAnnotation::STANDARD) {
+		return;
+	}
+	// find the element type of the (possibly multi-dimensional) array
+	const_reference<LogicalType> current_type = input;
+	reference<PostgresType> current_pg_type = postgres_type;
+	while (IsPostgresArray(current_type.get(), current_pg_type.get())) {
+		if (current_pg_type.get().children.empty()) {
+			return;
+		}
+		current_type = ListType::GetChildType(current_type.get());
+		current_pg_type = current_pg_type.get().children[0];
+	}
+	if (current_pg_type.get().oid == 0) {
+		current_pg_type.get().oid = element_oid;
+	}
+}
+
 PostgresVersion PostgresUtils::ExtractPostgresVersion(const string &version_str) {
 	PostgresVersion result;
 	idx_t pos = 0;
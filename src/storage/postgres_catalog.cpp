@@ -1,6 +1,7 @@
 #include "storage/postgres_catalog.hpp"
 #include "storage/postgres_schema_entry.hpp"
 #include "storage/postgres_transaction.hpp"
+#include "storage/postgres_replica_cache.hpp"
 #include "postgres_connection.hpp"
 #include "duckdb/storage/database_size.hpp"
 #include "duckdb/parser/parsed_data/drop_info.hpp"
@@ -11,23 +12,27 @@ namespace duckdb {
 
 PostgresCatalog::PostgresCatalog(AttachedDatabase &db_p, const string &path, AccessMode access_mode,
                                  string schema_to_load)
-    : Catalog(db_p), path(path), access_mode(access_mode), schemas(*this, schema_to_load), connection_pool(*this),
-      default_schema(schema_to_load) {
+    : Catalog(db_p), path(path), access_mode(access_mode), schemas(*this, schema_to_load),
+      connection_pool(PostgresConnectionPoolRegistry::Get().GetPool(path)), default_schema(schema_to_load) {
 	if (default_schema.empty()) {
 		default_schema = "public";
 	}
 	Value connection_limit;
 	auto &db_instance = db_p.GetDatabase();
 	if (db_instance.TryGetCurrentSetting("pg_connection_limit", connection_limit)) {
-		connection_pool.SetMaximumConnections(UBigIntValue::Get(connection_limit));
+		connection_pool->SetMaximumConnections(db_instance, UBigIntValue::Get(connection_limit));
 	}
 
-	auto connection = connection_pool.GetConnection();
+	auto connection = connection_pool->GetConnection();
 	this->version = connection.GetConnection().GetPostgresVersion();
 }
 
 PostgresCatalog::~PostgresCatalog() = default;
 
+void PostgresCatalog::SetReplicaCache(unique_ptr<PostgresReplicaCache> replica_cache_p) {
+	replica_cache = std::move(replica_cache_p);
+}
+
 void PostgresCatalog::Initialize(bool load_builtin) {
 }
 
@@ -103,6 +108,7 @@ DatabaseSize PostgresCatalog::GetDatabaseSize(ClientContext &context) {
 
 void PostgresCatalog::ClearCache() {
 	schemas.ClearEntries();
+	query_cache.Clear();
 }
 
 } // namespace duckdb
@@ -2,6 +2,7 @@
 #include "storage/postgres_transaction.hpp"
 #include "duckdb/parser/parsed_data/drop_info.hpp"
 #include "storage/postgres_schema_entry.hpp"
+#include "storage/postgres_catalog.hpp"
 
 namespace duckdb {
 
@@ -74,6 +75,8 @@ void PostgresCatalogSet::DropEntry(ClientContext &context, DropInfo &info) {
 	}
 	auto &transaction = PostgresTransaction::Get(context, catalog);
 	transaction.Query(drop_query);
+	// queries that referenced the dropped entry might now return a different result
+	catalog.Cast<PostgresCatalog>().GetQueryCache().Clear();
 
 	// erase the entry from the catalog set
 	lock_guard<mutex> l(entry_lock);
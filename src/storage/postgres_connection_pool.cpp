@@ -1,5 +1,10 @@
 #include "storage/postgres_connection_pool.hpp"
-#include "storage/postgres_catalog.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+
+#ifndef _WIN32
+#include <poll.h>
+#endif
 
 namespace duckdb {
 static bool pg_use_connection_cache = true;
@@ -40,34 +45,177 @@ PostgresConnection &PostgresPoolConnection::GetConnection() {
 	return connection;
 }
 
-PostgresConnectionPool::PostgresConnectionPool(PostgresCatalog &postgres_catalog, idx_t maximum_connections_p)
-    : postgres_catalog(postgres_catalog), active_connections(0), maximum_connections(maximum_connections_p) {
+PostgresConnectionPool::PostgresConnectionPool(string connection_string_p, idx_t maximum_connections_p)
+    : connection_string(std::move(connection_string_p)), active_connections(0),
+      maximum_connections(maximum_connections_p) {
+}
+
+PostgresConnectionPool::~PostgresConnectionPool() {
+	if (prewarm_thread.joinable()) {
+		prewarm_thread.join();
+	}
+	{
+		lock_guard<mutex> l(connection_lock);
+		shutdown = true;
+		maintenance_signal.notify_all();
+	}
+	if (maintenance_thread.joinable()) {
+		maintenance_thread.join();
+	}
 }
 
-PostgresPoolConnection PostgresConnectionPool::GetConnectionInternal() {
+//! Whether or not an idle connection can be handed out - without blocking
+static bool PostgresConnectionIsUsable(PostgresConnection &connection) {
+	if (!connection.IsOpen()) {
+		return false;
+	}
+	auto pg_con = connection.GetConn();
+	if (PQstatus(pg_con) != CONNECTION_OK || PQtransactionStatus(pg_con) != PQTRANS_IDLE) {
+		return false;
+	}
+	// the server only sends data on an idle connection when it is about to close it - e.g. the FATAL message of a
+	// terminated backend or an idle timeout, which can arrive before the connection is closed
+	// any unsolicited input therefore means that the connection cannot be used
+#ifndef _WIN32
+	pollfd fd;
+	fd.fd = PQsocket(pg_con);
+	fd.events = POLLIN;
+	fd.revents = 0;
+	return poll(&fd, 1, 0) == 0;
+#else
+	// no poll() - the second read sees the end of the connection that follows the FATAL message
+	return PQconsumeInput(pg_con) && PQconsumeInput(pg_con) && PQstatus(pg_con) == CONNECTION_OK;
+#endif
+}
+
+bool PostgresConnectionPool::TryReserveSlot(bool force) {
+	if (!force && active_connections >= maximum_connections) {
+		return false;
+	}
+	if (!PostgresConnectionPoolRegistry::Get().TryReserveConnection(force)) {
+		return false;
+	}
 	active_connections++;
-	// check if we have any cached connections left
-	if (!connection_cache.empty()) {
-		auto connection = PostgresPoolConnection(this, std::move(connection_cache.back()));
-		connection_cache.pop_back();
-		return connection;
+	return true;
+}
+
+void PostgresConnectionPool::ReleaseSlot() {
+	active_connections--;
+	PostgresConnectionPoolRegistry::Get().ReleaseConnection();
+	connection_available.notify_all();
+}
+
+PostgresConnection PostgresConnectionPool::TakeCachedConnection() {
+	if (connection_cache.empty()) {
+		return PostgresConnection();
 	}
+	auto connection = std::move(connection_cache.back());
+	connection_cache.pop_back();
+	return connection;
+}
 
-	// no cached connections left but there is space to open a new one - open it
-	return PostgresPoolConnection(this, PostgresConnection::Open(postgres_catalog.path));
+bool PostgresConnectionPool::ExceedsMaxLifetime(PostgresConnection &connection,
+                                                std::chrono::steady_clock::time_point now) const {
+	return options.max_lifetime > 0 &&
+	       now - connection.GetConnection()->opened_at >= std::chrono::seconds(options.max_lifetime);
+}
+
+PostgresPoolConnection PostgresConnectionPool::FinishConnection(PostgresConnection connection) {
+	while (connection.IsOpen()) {
+		bool expired = ExceedsMaxLifetime(connection, std::chrono::steady_clock::now());
+		if (!expired && PostgresConnectionIsUsable(connection)) {
+			break;
+		}
+		// the cached connection is stale - try the next one
+		// expired connections are closed when "stale" goes out of scope, after the lock has been released
+		auto stale = std::move(connection);
+		lock_guard<mutex> l(connection_lock);
+		if (!expired) {
+			Quarantine(std::move(stale));
+		}
+		if (!connection_cache.empty()) {
+			connection = std::move(connection_cache.back());
+			connection_cache.pop_back();
+		}
+	}
+	if (!connection.IsOpen()) {
+		// no cached connections left but there is space to open a new one - open it
+		try {
+			connection = PostgresConnection::Open(connection_string);
+		} catch (...) {
+			lock_guard<mutex> l(connection_lock);
+			ReleaseSlot();
+			throw;
+		}
+	}
+	return PostgresPoolConnection(this, std::move(connection));
 }
 
 PostgresPoolConnection PostgresConnectionPool::ForceGetConnection() {
-	lock_guard<mutex> l(connection_lock);
-	return GetConnectionInternal();
+	PostgresConnection connection;
+	{
+		lock_guard<mutex> l(connection_lock);
+		TryReserveSlot(true);
+		connection = TakeCachedConnection();
+	}
+	return FinishConnection(std::move(connection));
 }
 
-bool PostgresConnectionPool::TryGetConnection(PostgresPoolConnection &connection) {
-	lock_guard<mutex> l(connection_lock);
-	if (active_connections >= maximum_connections) {
-		return false;
+bool PostgresConnectionPool::TryGetConnection(PostgresPoolConnection &result) {
+	PostgresConnection connection;
+	{
+		lock_guard<mutex> l(connection_lock);
+		// do not jump the queue if others are waiting for a connection
+		if (!waiters.empty() || !TryReserveSlot()) {
+			return false;
+		}
+		connection = TakeCachedConnection();
+	}
+	result = FinishConnection(std::move(connection));
+	return true;
+}
+
+bool PostgresConnectionPool::TryGetConnection(PostgresPoolConnection &result, idx_t timeout_ms,
+                                              const std::function<bool()> &should_stop) {
+	static constexpr idx_t STOP_CHECK_INTERVAL_MS = 50;
+
+	PostgresConnection connection;
+	{
+		unique_lock<mutex> l(connection_lock);
+		if (!waiters.empty() || !TryReserveSlot()) {
+			if (timeout_ms == 0) {
+				return false;
+			}
+			auto waiter_id = next_waiter_id++;
+			waiters.push_back(waiter_id);
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+			bool acquired = false;
+			while (true) {
+				if (waiters.front() == waiter_id && TryReserveSlot()) {
+					acquired = true;
+					break;
+				}
+				auto now = std::chrono::steady_clock::now();
+				if (now >= deadline || (should_stop && should_stop())) {
+					break;
+				}
+				// if this pool has a free slot the process-wide connection limit has been reached - slots that free up
+				// in other pools are not signaled to this pool, so we have to check periodically
+				bool poll = should_stop || active_connections < maximum_connections;
+				auto wait_until =
+				    poll ? MinValue(deadline, now + std::chrono::milliseconds(STOP_CHECK_INTERVAL_MS)) : deadline;
+				connection_available.wait_until(l, wait_until);
+			}
+			waiters.erase(std::find(waiters.begin(), waiters.end(), waiter_id));
+			// the next waiter in line might be able to proceed now
+			connection_available.notify_all();
+			if (!acquired) {
+				return false;
+			}
+		}
+		connection = TakeCachedConnection();
 	}
-	connection = GetConnectionInternal();
+	result = FinishConnection(std::move(connection));
 	return true;
 }
 
@@ -78,9 +226,17 @@ void PostgresConnectionPool::PostgresSetConnectionCache(ClientContext &context,
 	pg_use_connection_cache = BooleanValue::Get(parameter);
 }
 
-PostgresPoolConnection PostgresConnectionPool::GetConnection() {
+idx_t PostgresConnectionPool::GetAcquireTimeout(ClientContext &context) {
+	Value timeout;
+	if (!context.TryGetCurrentSetting("pg_pool_acquire_timeout", timeout) || timeout.IsNull()) {
+		return 0;
+	}
+	return UBigIntValue::Get(timeout);
+}
+
+PostgresPoolConnection PostgresConnectionPool::GetConnection(idx_t timeout_ms) {
 	PostgresPoolConnection result;
-	if (!TryGetConnection(result)) {
+	if (!TryGetConnection(result, timeout_ms)) {
 		throw IOException(
 		    "Failed to get connection from PostgresConnectionPool - maximum connection count exceeded (%llu/%llu max)",
 		    active_connections, maximum_connections);
@@ -89,35 +245,144 @@ PostgresPoolConnection PostgresConnectionPool::GetConnection() {
 }
 
 void PostgresConnectionPool::ReturnConnection(PostgresConnection connection) {
+	// statements that were queued for the previous user of the connection are never sent
+	connection.DiscardPendingStatements();
+	// check if the underlying connection can be reused as-is - this does not touch the network
+	bool is_idle = connection.IsOpen() && PQstatus(connection.GetConn()) == CONNECTION_OK &&
+	               PQtransactionStatus(connection.GetConn()) == PQTRANS_IDLE;
 	lock_guard<mutex> l(connection_lock);
 	if (active_connections <= 0) {
 		throw InternalException("PostgresConnectionPool::ReturnConnection called but active_connections is 0");
 	}
-	active_connections--;
+	ReleaseSlot();
 	if (active_connections >= maximum_connections) {
 		// if the maximum number of connections has been decreased by the user we might need to reclaim the connection
 		// immediately
 		return;
 	}
-	if (!pg_use_connection_cache) {
+	if (!pg_use_connection_cache || !connection.IsOpen()) {
 		return;
 	}
-	// check if the underlying connection is still usable
-	auto pg_con = connection.GetConn();
-	if (PQstatus(connection.GetConn()) != CONNECTION_OK) {
-		// CONNECTION_BAD! try to reset it
-		PQreset(pg_con);
-		if (PQstatus(connection.GetConn()) != CONNECTION_OK) {
-			// still bad - just abandon this one
-			return;
-		}
+	if (!is_idle) {
+		// the connection is broken or still in a transaction - let the maintenance thread reset it
+		Quarantine(std::move(connection));
+		return;
 	}
-	if (PQtransactionStatus(pg_con) != PQTRANS_IDLE) {
+	auto now = std::chrono::steady_clock::now();
+	if (ExceedsMaxLifetime(connection, now)) {
 		return;
 	}
+	connection.GetConnection()->idle_since = now;
 	connection_cache.push_back(std::move(connection));
 }
 
+void PostgresConnectionPool::Quarantine(PostgresConnection connection) {
+	if (shutdown) {
+		return;
+	}
+	quarantine.push_back(std::move(connection));
+	StartMaintenance();
+	maintenance_signal.notify_all();
+}
+
+void PostgresConnectionPool::StartMaintenance() {
+	if (!maintenance_thread.joinable()) {
+		maintenance_thread = std::thread([this]() { RunMaintenance(); });
+	}
+}
+
+vector<PostgresConnection> PostgresConnectionPool::EvictExpiredConnections() {
+	vector<PostgresConnection> expired;
+	if (options.idle_timeout == 0 && options.max_lifetime == 0) {
+		return expired;
+	}
+	auto now = std::chrono::steady_clock::now();
+	auto idle_timeout = std::chrono::seconds(options.idle_timeout);
+	// connections are handed out from the back of the cache - the front holds the connections idle the longest
+	vector<PostgresConnection> remaining;
+	for (idx_t i = 0; i < connection_cache.size(); i++) {
+		auto &connection = connection_cache[i];
+		bool idle_expired = options.idle_timeout > 0 && now - connection.GetConnection()->idle_since >= idle_timeout &&
+		                    connection_cache.size() - expired.size() > options.minimum_connections;
+		if (idle_expired || ExceedsMaxLifetime(connection, now)) {
+			expired.push_back(std::move(connection));
+		} else {
+			remaining.push_back(std::move(connection));
+		}
+	}
+	connection_cache = std::move(remaining);
+	return expired;
+}
+
+//! Tries to bring a quarantined connection back into a usable state - this can block
+static bool PostgresRepairConnection(PostgresConnection &connection) {
+	auto pg_con = connection.GetConn();
+	if (PQstatus(pg_con) != CONNECTION_OK) {
+		PQreset(pg_con);
+		return PostgresConnectionIsUsable(connection);
+	}
+	switch (PQtransactionStatus(pg_con)) {
+	case PQTRANS_INTRANS:
+	case PQTRANS_INERROR:
+		// the connection was returned in the middle of a transaction (e.g. by a scan) - roll it back
+		return connection.TryQuery("ROLLBACK") && PostgresConnectionIsUsable(connection);
+	case PQTRANS_IDLE:
+		return PostgresConnectionIsUsable(connection);
+	default:
+		// a command is still in progress - close the connection
+		return false;
+	}
+}
+
+void PostgresConnectionPool::RunMaintenance() {
+	unique_lock<mutex> l(connection_lock);
+	while (!shutdown) {
+		if (quarantine.empty()) {
+			// check for expired connections periodically - at twice the rate of the shortest timeout
+			auto interval = MinValue<idx_t>(options.idle_timeout == 0 ? NumericLimits<idx_t>::Maximum()
+			                                                          : options.idle_timeout,
+			                                options.max_lifetime == 0 ? NumericLimits<idx_t>::Maximum()
+			                                                          : options.max_lifetime);
+			if (interval == NumericLimits<idx_t>::Maximum()) {
+				maintenance_signal.wait(l);
+			} else {
+				maintenance_signal.wait_for(l, std::chrono::milliseconds(MaxValue<idx_t>(interval * 500, 1000)));
+			}
+			if (shutdown) {
+				break;
+			}
+		}
+		auto connections = std::move(quarantine);
+		quarantine.clear();
+		auto expired = EvictExpiredConnections();
+		l.unlock();
+		// expired connections are closed outside of the lock
+		expired.clear();
+		vector<PostgresConnection> repaired;
+		for (auto &connection : connections) {
+			if (PostgresRepairConnection(connection)) {
+				repaired.push_back(std::move(connection));
+			}
+		}
+		// connections that could not be repaired are closed here - outside of the lock
+		connections.clear();
+		l.lock();
+		for (auto &connection : repaired) {
+			if (!pg_use_connection_cache || active_connections + connection_cache.size() >= maximum_connections) {
+				break;
+			}
+			connection.GetConnection()->idle_since = std::chrono::steady_clock::now();
+			connection_cache.push_back(std::move(connection));
+		}
+		if (!repaired.empty()) {
+			// close any connections that did not fit into the cache outside of the lock
+			l.unlock();
+			repaired.clear();
+			l.lock();
+		}
+	}
+}
+
 void PostgresConnectionPool::SetMaximumConnections(idx_t new_max) {
 	lock_guard<mutex> l(connection_lock);
 	if (new_max < maximum_connections) {
@@ -131,6 +396,196 @@ void PostgresConnectionPool::SetMaximumConnections(idx_t new_max) {
 		}
 	}
 	maximum_connections = new_max;
+	connection_available.notify_all();
+}
+
+void PostgresConnectionPool::SetMaximumConnections(DatabaseInstance &instance, idx_t new_max) {
+	{
+		lock_guard<mutex> l(connection_lock);
+		auto owner = limit_owner.lock();
+		if (owner && owner.get() != &instance) {
+			// the pool is shared with another database instance - that instance's pg_connection_limit applies
+			return;
+		}
+		limit_owner = instance.shared_from_this();
+	}
+	SetMaximumConnections(new_max);
+}
+
+idx_t PostgresConnectionPool::ApplyOptions() {
+	if (options.idle_timeout > 0 || options.max_lifetime > 0) {
+		// the maintenance thread closes expired connections
+		StartMaintenance();
+	}
+	maintenance_signal.notify_all();
+	return options.minimum_connections;
+}
+
+void PostgresConnectionPool::SetOptions(PostgresPoolOptions new_options) {
+	idx_t prewarm_count;
+	{
+		lock_guard<mutex> l(connection_lock);
+		options = new_options;
+		prewarm_count = ApplyOptions();
+	}
+	if (prewarm_count > 0) {
+		// open the connections in the background so that the first queries do not have to wait for them
+		PrewarmInBackground(prewarm_count);
+	}
+}
+
+static void CheckPoolOption(const char *name, const optional_idx &current, const optional_idx &new_value) {
+	if (current.IsValid() && new_value.IsValid() && current.GetIndex() != new_value.GetIndex()) {
+		throw BinderException("Cannot set %s to %llu - the connection pool is shared with an attached database that "
+		                      "set it to %llu",
+		                      name, new_value.GetIndex(), current.GetIndex());
+	}
+}
+
+static void SetPoolOption(optional_idx &current, const optional_idx &new_value, idx_t &option) {
+	if (new_value.IsValid()) {
+		current = new_value;
+		option = new_value.GetIndex();
+	}
+}
+
+void PostgresConnectionPool::SetExplicitOptions(const PostgresExplicitPoolOptions &new_options) {
+	idx_t prewarm_count;
+	{
+		lock_guard<mutex> l(connection_lock);
+		// check all options before changing any of them
+		CheckPoolOption("pool_min_size", explicit_options.minimum_connections, new_options.minimum_connections);
+		CheckPoolOption("pool_idle_timeout", explicit_options.idle_timeout, new_options.idle_timeout);
+		CheckPoolOption("pool_max_lifetime", explicit_options.max_lifetime, new_options.max_lifetime);
+		SetPoolOption(explicit_options.minimum_connections, new_options.minimum_connections,
+		              options.minimum_connections);
+		SetPoolOption(explicit_options.idle_timeout, new_options.idle_timeout, options.idle_timeout);
+		SetPoolOption(explicit_options.max_lifetime, new_options.max_lifetime, options.max_lifetime);
+		prewarm_count = ApplyOptions();
+	}
+	if (prewarm_count > 0) {
+		PrewarmInBackground(prewarm_count);
+	}
+}
+
+void PostgresConnectionPool::Prewarm(idx_t connection_count) {
+	idx_t open_count;
+	{
+		lock_guard<mutex> l(connection_lock);
+		auto total_open_connections = active_connections + connection_cache.size();
+		if (!pg_use_connection_cache || connection_cache.size() >= connection_count ||
+		    total_open_connections >= maximum_connections) {
+			return;
+		}
+		open_count = MinValue<idx_t>(connection_count - connection_cache.size(),
+		                             maximum_connections - total_open_connections);
+	}
+	// establish the connections without holding the lock
+	auto connections = PostgresConnection::OpenConcurrently(connection_string, open_count);
+	lock_guard<mutex> l(connection_lock);
+	for (auto &connection : connections) {
+		if (active_connections + connection_cache.size() >= maximum_connections) {
+			break;
+		}
+		connection_cache.push_back(std::move(connection));
+	}
+}
+
+void PostgresConnectionPool::PrewarmInBackground(idx_t connection_count) {
+	if (prewarm_thread.joinable()) {
+		prewarm_thread.join();
+	}
+	prewarm_thread = std::thread([this, connection_count]() {
+		try {
+			Prewarm(connection_count);
+		} catch (std::exception &ex) {
+			// connection errors are reported once a connection is requested
+		}
+	});
+}
+
+bool PostgresConnectionPool::IsEmpty() {
+	lock_guard<mutex> l(connection_lock);
+	return active_connections == 0 && connection_cache.empty() && quarantine.empty();
+}
+
+PostgresConnectionPoolRegistry &PostgresConnectionPoolRegistry::Get() {
+	static PostgresConnectionPoolRegistry registry;
+	return registry;
+}
+
+string PostgresConnectionPoolRegistry::NormalizeConnectionString(const string &connection_string) {
+	char *error_message = nullptr;
+	auto options = PQconninfoParse(connection_string.c_str(), &error_message);
+	if (!options) {
+		// the connection string is invalid - the error is reported when connecting
+		if (error_message) {
+			PQfreemem(error_message);
+		}
+		return connection_string;
+	}
+	// libpq returns the options in a fixed order - both for key/value connection strings and for URIs
+	string result;
+	for (auto option = options; option->keyword; option++) {
+		if (!option->val || option->val[0] == '\0') {
+			continue;
+		}
+		result += option->keyword;
+		result += "=";
+		result += option->val;
+		result += "\n";
+	}
+	PQconninfoFree(options);
+	return result;
+}
+
+shared_ptr<PostgresConnectionPool> PostgresConnectionPoolRegistry::GetPool(const string &connection_string) {
+	auto key = NormalizeConnectionString(connection_string);
+	// pools that are no longer used are destroyed after the lock has been released
+	vector<shared_ptr<PostgresConnectionPool>> unused_pools;
+	lock_guard<mutex> l(lock);
+	for (auto entry = pools.begin(); entry != pools.end();) {
+		if (entry->first != key && entry->second.use_count() == 1 && entry->second->IsEmpty()) {
+			unused_pools.push_back(std::move(entry->second));
+			entry = pools.erase(entry);
+		} else {
+			entry++;
+		}
+	}
+	auto &pool = pools[key];
+	if (!pool) {
+		pool = make_shared_ptr<PostgresConnectionPool>(connection_string);
+		// close connections that are idle for longer than the default idle timeout
+		pool->SetOptions(PostgresPoolOptions());
+	}
+	return pool;
+}
+
+void PostgresConnectionPoolRegistry::SetMaximumConnections(idx_t new_max) {
+	maximum_connections = new_max;
+}
+
+bool PostgresConnectionPoolRegistry::TryReserveConnection(bool force) {
+	auto current = active_connections.load();
+	do {
+		auto max = maximum_connections.load();
+		if (!force && max > 0 && current >= max) {
+			return false;
+		}
+	} while (!active_connections.compare_exchange_weak(current, current + 1));
+	return true;
+}
+
+void PostgresConnectionPoolRegistry::ReleaseConnection() {
+	active_connections--;
+}
+
+void PostgresConnectionPoolRegistry::PostgresSetGlobalConnectionLimit(ClientContext &context, SetScope scope,
+                                                                      Value &parameter) {
+	if (parameter.IsNull()) {
+		throw BinderException("Cannot be set to NULL");
+	}
+	Get().SetMaximumConnections(UBigIntValue::Get(parameter));
 }
 
 } // namespace duckdb
@@ -1,10 +1,12 @@
 #include "storage/postgres_delete.hpp"
+#include "storage/postgres_dml_pushdown.hpp"
 #include "storage/postgres_table_entry.hpp"
 #include "duckdb/planner/operator/logical_delete.hpp"
 #include "storage/postgres_catalog.hpp"
 #include "storage/postgres_transaction.hpp"
 #include "postgres_connection.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/common/types/uuid.hpp"
 
 namespace duckdb {
 
@@ -15,12 +17,24 @@ PostgresDelete::PostgresDelete(LogicalOperator &op, TableCatalogEntry &table, id
 //===--------------------------------------------------------------------===//
 // States
 //===--------------------------------------------------------------------===//
-string GetDeleteSQL(const PostgresTableEntry &table, const string &ctid_list) {
+string CreateDeleteTable(const string &name) {
+	string result;
+	result = "CREATE LOCAL TEMPORARY TABLE " + KeywordHelper::WriteOptionallyQuoted(name);
+	result += "(__page_id TID) ON COMMIT DROP";
+	return result;
+}
+
+string GetDeleteSQL(const string &name, const PostgresTableEntry &table) {
 	string result;
 	result = "DELETE FROM ";
 	result += KeywordHelper::WriteQuoted(table.schema.name, '"') + ".";
-	result += KeywordHelper::WriteOptionallyQuoted(table.name);
-	result += " WHERE ctid IN (" + ctid_list + ")";
+	result += KeywordHelper::WriteQuoted(table.name, '"');
+	result += " USING " + KeywordHelper::WriteOptionallyQuoted(name);
+	result += " WHERE ";
+	result += KeywordHelper::WriteQuoted(table.name, '"');
+	result += ".ctid=";
+	result += KeywordHelper::WriteOptionallyQuoted(name);
+	result += ".__page_id";
 	return result;
 }
 
@@ -30,17 +44,11 @@ public:
 	}
 
 	PostgresTableEntry &table;
-	string ctid_list;
+	PostgresCopyState copy_state;
+	DataChunk ctid_chunk;
+	DataChunk varchar_chunk;
+	string delete_table_name;
 	idx_t delete_count;
-
-	void Flush(ClientContext &context) {
-		if (ctid_list.empty()) {
-			return;
-		}
-		auto &transaction = PostgresTransaction::Get(context, table.catalog);
-		transaction.Query(GetDeleteSQL(table, ctid_list));
-		ctid_list = "";
-	}
 };
 
 unique_ptr<GlobalSinkState> PostgresDelete::GetGlobalSinkState(ClientContext &context) const {
@@ -48,6 +56,26 @@ unique_ptr<GlobalSinkState> PostgresDelete::GetGlobalSinkState(ClientContext &co
 
 	auto &transaction = PostgresTransaction::Get(context, postgres_table.catalog);
 	auto result = make_uniq<PostgresDeleteGlobalState>(postgres_table);
+	auto &connection = transaction.GetConnection();
+	transaction.AddWrittenTable(postgres_table.schema.name, postgres_table.name);
+	// create a temporary table to stream the row ids that should be deleted into
+	result->delete_table_name = "delete_data_" + UUID::ToString(UUID::GenerateRandomUUID());
+	connection.Execute(CreateDeleteTable(result->delete_table_name));
+
+	// row ids are written as native tids in binary mode and as "(page,row)" strings in text mode
+	auto format = PostgresTableEntry::UseBinaryCopy(context) ? PostgresCopyFormat::BINARY : PostgresCopyFormat::TEXT;
+	vector<LogicalType> ctid_types;
+	ctid_types.push_back(format == PostgresCopyFormat::BINARY ? LogicalType::BIGINT : LogicalType::VARCHAR);
+	result->ctid_chunk.Initialize(context, ctid_types);
+
+	// begin the COPY TO
+	string schema_name;
+	vector<string> column_names;
+	connection.BeginCopyTo(context, result->copy_state, format, schema_name, result->delete_table_name,
+	                       column_names);
+	PostgresType ctid_type;
+	ctid_type.info = PostgresTypeAnnotation::CTID;
+	result->copy_state.column_types.push_back(std::move(ctid_type));
 	return std::move(result);
 }
 
@@ -59,24 +87,32 @@ SinkResultType PostgresDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 
 	chunk.Flatten();
 	auto &row_identifiers = chunk.data[row_id_index];
-	auto row_data = FlatVector::GetData<row_t>(row_identifiers);
-	for (idx_t i = 0; i < chunk.size(); i++) {
-		if (!gstate.ctid_list.empty()) {
-			gstate.ctid_list += ",";
-		}
-		// extract the ctid from the row id
-		auto row_in_page = row_data[i] & 0xFFFF;
-		auto page_index = row_data[i] >> 16;
-		gstate.ctid_list += "'(";
-		gstate.ctid_list += to_string(page_index);
-		gstate.ctid_list += ",";
-		gstate.ctid_list += to_string(row_in_page);
-		gstate.ctid_list += ")'";
-		if (gstate.ctid_list.size() > 3000) {
-			// avoid making too long SQL statements
-			gstate.Flush(context.client);
+	auto &ctid_vector = gstate.ctid_chunk.data[0];
+	if (gstate.copy_state.format == PostgresCopyFormat::BINARY) {
+		// the binary writer converts the row ids into tids directly
+		ctid_vector.Reference(row_identifiers);
+	} else {
+		auto row_data = FlatVector::GetData<row_t>(row_identifiers);
+		auto varchar_data = FlatVector::GetData<string_t>(ctid_vector);
+		for (idx_t r = 0; r < chunk.size(); r++) {
+			// extract the ctid from the row id
+			auto row_in_page = row_data[r] & 0xFFFF;
+			auto page_index = row_data[r] >> 16;
+
+			string ctid_string;
+			ctid_string += "(";
+			ctid_string += to_string(page_index);
+			ctid_string += ",";
+			ctid_string += to_string(row_in_page);
+			ctid_string += ")";
+			varchar_data[r] = StringVector::AddString(ctid_vector, ctid_string);
 		}
 	}
+	gstate.ctid_chunk.SetCardinality(chunk);
+
+	auto &transaction = PostgresTransaction::Get(context.client, gstate.table.catalog);
+	auto &connection = transaction.GetConnection();
+	connection.CopyChunk(context.client, gstate.copy_state, gstate.ctid_chunk, gstate.varchar_chunk);
 	gstate.delete_count += chunk.size();
 	return SinkResultType::NEED_MORE_INPUT;
 }
@@ -87,7 +123,17 @@ SinkResultType PostgresDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 SinkFinalizeType PostgresDelete::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                           OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<PostgresDeleteGlobalState>();
-	gstate.Flush(context);
+	auto &transaction = PostgresTransaction::Get(context, gstate.table.catalog);
+	auto &connection = transaction.GetConnection();
+	// flush the copy to state
+	connection.FinishCopyTo(gstate.copy_state);
+	if (gstate.delete_count == 0) {
+		return SinkFinalizeType::READY;
+	}
+	// gather statistics on the row ids so Postgres picks a sensible join strategy
+	connection.Execute("ANALYZE " + KeywordHelper::WriteOptionallyQuoted(gstate.delete_table_name));
+	// delete all rows in a single statement
+	connection.Execute(GetDeleteSQL(gstate.delete_table_name, gstate.table));
 	return SinkFinalizeType::READY;
 }
 
@@ -124,6 +170,10 @@ unique_ptr<PhysicalOperator> PostgresCatalog::PlanDelete(ClientContext &context,
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for deletion of a Postgres table");
 	}
+	auto pushdown = PostgresDMLPushdown::TryPlanDelete(context, op, *plan);
+	if (pushdown) {
+		return pushdown;
+	}
 	auto &bound_ref = op.expressions[0]->Cast<BoundReferenceExpression>();
 	PostgresCatalog::MaterializePostgresScans(*plan);
 
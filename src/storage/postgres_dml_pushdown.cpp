@@ -0,0 +1,620 @@
+#include "storage/postgres_dml_pushdown.hpp"
+#include "storage/postgres_catalog.hpp"
+#include "storage/postgres_table_entry.hpp"
+#include "storage/postgres_transaction.hpp"
+#include "postgres_scanner.hpp"
+#include "postgres_result.hpp"
+#include "postgres_filter_pushdown.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/planner/operator/logical_insert.hpp"
+#include "duckdb/planner/operator/logical_update.hpp"
+#include "duckdb/planner/operator/logical_delete.hpp"
+#include "duckdb/planner/expression/list.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+
+namespace duckdb {
+
+PostgresDMLPushdown::PostgresDMLPushdown(LogicalOperator &op, TableCatalogEntry &table, string sql_p)
+    : PhysicalOperator(PhysicalOperatorType::EXTENSION, op.types, 1), table(table), sql(std::move(sql_p)) {
+}
+
+//===--------------------------------------------------------------------===//
+// Plan Translation
+//===--------------------------------------------------------------------===//
+struct PushdownColumn {
+	//! The SQL expression that computes this column in Postgres
+	string sql;
+	//! Whether or not this column is the ctid of the scanned table
+	bool is_ctid = false;
+	//! Whether or not DuckDB and Postgres agree on the semantics of operations on this column
+	bool is_comparable = true;
+	//! The oid of the column in Postgres (if it is a plain column and the oid is known)
+	idx_t oid = 0;
+};
+
+struct PushdownRelation {
+	optional_ptr<PostgresBindData> bind_data;
+	vector<PushdownColumn> columns;
+	vector<string> filters;
+
+	string GetTableName() const {
+		return KeywordHelper::WriteQuoted(bind_data->schema_name, '"') + "." +
+		       KeywordHelper::WriteQuoted(bind_data->table_name, '"');
+	}
+
+	string GetWhereClause() const {
+		if (filters.empty()) {
+			return string();
+		}
+		return " WHERE " + StringUtil::Join(filters, " AND ");
+	}
+};
+
+static bool IsPushdownType(const LogicalType &type) {
+	if (type.HasAlias()) {
+		return false;
+	}
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::INTERVAL:
+	case LogicalTypeId::UUID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsNumericType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsIntegerType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! The amount of decimal digits that every value of an integer type fits in
+static uint8_t IntegerDigits(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::SMALLINT:
+		return 5;
+	case LogicalTypeId::INTEGER:
+		return 10;
+	case LogicalTypeId::BIGINT:
+		return 19;
+	default:
+		throw InternalException("Unsupported type for IntegerDigits");
+	}
+}
+
+//! Whether or not every value of the source type is represented exactly by the target type - only then do DuckDB and
+//! Postgres agree on the result of the cast (e.g. they round and range-check differently)
+static bool IsWideningCast(const LogicalType &source, const LogicalType &target) {
+	if (IsIntegerType(source)) {
+		switch (target.id()) {
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::BIGINT:
+			return IntegerDigits(target) >= IntegerDigits(source);
+		case LogicalTypeId::DECIMAL:
+			return DecimalType::GetWidth(target) - DecimalType::GetScale(target) >= IntegerDigits(source);
+		case LogicalTypeId::FLOAT:
+			// 24 bits of mantissa
+			return source.id() == LogicalTypeId::SMALLINT;
+		case LogicalTypeId::DOUBLE:
+			// 53 bits of mantissa
+			return source.id() != LogicalTypeId::BIGINT;
+		default:
+			return false;
+		}
+	}
+	switch (source.id()) {
+	case LogicalTypeId::FLOAT:
+		return target.id() == LogicalTypeId::DOUBLE;
+	case LogicalTypeId::DECIMAL: {
+		if (target.id() != LogicalTypeId::DECIMAL) {
+			return false;
+		}
+		auto source_integer_digits = DecimalType::GetWidth(source) - DecimalType::GetScale(source);
+		auto target_integer_digits = DecimalType::GetWidth(target) - DecimalType::GetScale(target);
+		return DecimalType::GetScale(target) >= DecimalType::GetScale(source) &&
+		       target_integer_digits >= source_integer_digits;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool TryTransformExpression(const Expression &expr, const vector<PushdownColumn> &columns, string &result);
+
+static bool TryTransformChildren(const vector<unique_ptr<Expression>> &children, const vector<PushdownColumn> &columns,
+                                 vector<string> &result) {
+	for (auto &child : children) {
+		string child_sql;
+		if (!TryTransformExpression(*child, columns, child_sql)) {
+			return false;
+		}
+		result.push_back(std::move(child_sql));
+	}
+	return true;
+}
+
+static bool TryTransformComparison(ExpressionType type, const Expression &left, const Expression &right,
+                                   const vector<PushdownColumn> &columns, string &result) {
+	string op;
+	switch (type) {
+	case ExpressionType::COMPARE_EQUAL:
+		op = "=";
+		break;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		op = "<>";
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		op = "<";
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		op = ">";
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		op = "<=";
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		op = ">=";
+		break;
+	case ExpressionType::COMPARE_DISTINCT_FROM:
+		op = "IS DISTINCT FROM";
+		break;
+	case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+		op = "IS NOT DISTINCT FROM";
+		break;
+	default:
+		return false;
+	}
+	string left_sql, right_sql;
+	if (!TryTransformExpression(left, columns, left_sql) || !TryTransformExpression(right, columns, right_sql)) {
+		return false;
+	}
+	if (left.return_type.id() == LogicalTypeId::VARCHAR) {
+		// DuckDB compares strings byte-wise - make sure Postgres does not use a linguistic collation
+		left_sql += " COLLATE \"C\"";
+	}
+	result = "(" + left_sql + " " + op + " " + right_sql + ")";
+	return true;
+}
+
+static bool TryTransformConstant(const Value &value, string &result) {
+	auto &type = value.type();
+	if (!IsPushdownType(type)) {
+		return false;
+	}
+	auto type_name = PostgresUtils::TypeToString(type);
+	if (value.IsNull()) {
+		result = "NULL::" + type_name;
+	} else {
+		result = KeywordHelper::WriteQuoted(value.ToString()) + "::" + type_name;
+	}
+	return true;
+}
+
+static bool TryTransformCast(const BoundCastExpression &cast, const vector<PushdownColumn> &columns, string &result) {
+	if (cast.try_cast) {
+		return false;
+	}
+	auto &source = cast.child->return_type;
+	auto &target = cast.return_type;
+	if (!IsNumericType(source) || !IsPushdownType(target) || !IsWideningCast(source, target)) {
+		return false;
+	}
+	string child_sql;
+	if (!TryTransformExpression(*cast.child, columns, child_sql)) {
+		return false;
+	}
+	result = "CAST(" + child_sql + " AS " + PostgresUtils::TypeToString(target) + ")";
+	return true;
+}
+
+static bool TryTransformFunction(const BoundFunctionExpression &function, const vector<PushdownColumn> &columns,
+                                 string &result) {
+	if (!function.is_operator) {
+		return false;
+	}
+	auto &name = function.function.name;
+	auto &return_type = function.return_type;
+	vector<string> children;
+	if (!TryTransformChildren(function.children, columns, children)) {
+		return false;
+	}
+	if (children.size() == 1 && name == "-" && IsNumericType(return_type)) {
+		result = "(-" + children[0] + ")";
+		return true;
+	}
+	if (children.size() != 2) {
+		return false;
+	}
+	if (name == "+" || name == "-" || name == "*") {
+		if (!IsNumericType(return_type)) {
+			return false;
+		}
+	} else if (name == "%") {
+		if (!IsIntegerType(return_type)) {
+			return false;
+		}
+	} else if (name == "||") {
+		if (return_type.id() != LogicalTypeId::VARCHAR) {
+			return false;
+		}
+	} else {
+		return false;
+	}
+	if (name == "%") {
+		// modulo by zero is NULL in DuckDB, but raises an error in Postgres
+		children[1] = "NULLIF(" + children[1] + ", 0)";
+	}
+	result = "(" + children[0] + " " + name + " " + children[1] + ")";
+	return true;
+}
+
+static bool TryTransformExpression(const Expression &expr, const vector<PushdownColumn> &columns, string &result) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_REF: {
+		auto &ref = expr.Cast<BoundReferenceExpression>();
+		auto &column = columns[ref.index];
+		if (column.is_ctid || !column.is_comparable) {
+			return false;
+		}
+		result = column.sql;
+		return true;
+	}
+	case ExpressionClass::BOUND_CONSTANT:
+		return TryTransformConstant(expr.Cast<BoundConstantExpression>().value, result);
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = expr.Cast<BoundComparisonExpression>();
+		return TryTransformComparison(expr.type, *comparison.left, *comparison.right, columns, result);
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
+		auto &between = expr.Cast<BoundBetweenExpression>();
+		string lower_sql, upper_sql;
+		auto lower_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                          : ExpressionType::COMPARE_GREATERTHAN;
+		auto upper_type =
+		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
+		if (!TryTransformComparison(lower_type, *between.input, *between.lower, columns, lower_sql) ||
+		    !TryTransformComparison(upper_type, *between.input, *between.upper, columns, upper_sql)) {
+			return false;
+		}
+		result = "(" + lower_sql + " AND " + upper_sql + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = expr.Cast<BoundConjunctionExpression>();
+		vector<string> children;
+		if (!TryTransformChildren(conjunction.children, columns, children)) {
+			return false;
+		}
+		auto op = expr.type == ExpressionType::CONJUNCTION_AND ? " AND " : " OR ";
+		result = "(" + StringUtil::Join(children, op) + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		auto &op = expr.Cast<BoundOperatorExpression>();
+		vector<string> children;
+		if (!TryTransformChildren(op.children, columns, children)) {
+			return false;
+		}
+		switch (expr.type) {
+		case ExpressionType::OPERATOR_NOT:
+			result = "(NOT " + children[0] + ")";
+			return true;
+		case ExpressionType::OPERATOR_IS_NULL:
+			result = "(" + children[0] + " IS NULL)";
+			return true;
+		case ExpressionType::OPERATOR_IS_NOT_NULL:
+			result = "(" + children[0] + " IS NOT NULL)";
+			return true;
+		case ExpressionType::COMPARE_IN:
+		case ExpressionType::COMPARE_NOT_IN: {
+			if (op.children[0]->return_type.id() == LogicalTypeId::VARCHAR) {
+				children[0] += " COLLATE \"C\"";
+			}
+			auto in_list = StringUtil::Join(vector<string>(children.begin() + 1, children.end()), ", ");
+			auto in_op = expr.type == ExpressionType::COMPARE_IN ? " IN (" : " NOT IN (";
+			result = "(" + children[0] + in_op + in_list + "))";
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+	case ExpressionClass::BOUND_CAST:
+		return TryTransformCast(expr.Cast<BoundCastExpression>(), columns, result);
+	case ExpressionClass::BOUND_FUNCTION:
+		return TryTransformFunction(expr.Cast<BoundFunctionExpression>(), columns, result);
+	default:
+		return false;
+	}
+}
+
+static bool IsComparable(const LogicalType &type, const PostgresType &pg_type) {
+	return pg_type.info == PostgresTypeAnnotation::STANDARD && IsPushdownType(type);
+}
+
+//! Try to copy a column into a column in Postgres
+static bool TryTransformColumnValue(const PushdownColumn &column, const ColumnDefinition &target,
+                                    const PostgresType &target_pg_type, string &result) {
+	if (column.is_ctid) {
+		return false;
+	}
+	// plain columns can be copied if Postgres assigns them in the same way as DuckDB does
+	bool same_type = column.oid != 0 && column.oid == target_pg_type.oid;
+	if (!same_type && !(column.is_comparable && IsComparable(target.GetType(), target_pg_type))) {
+		return false;
+	}
+	result = column.sql;
+	return true;
+}
+
+//! Try to transform an expression that produces a value that is written to a column in Postgres
+static bool TryTransformValue(const Expression &expr, const vector<PushdownColumn> &columns,
+                              const ColumnDefinition &target, const PostgresType &target_pg_type, string &result) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		auto &column = columns[expr.Cast<BoundReferenceExpression>().index];
+		return TryTransformColumnValue(column, target, target_pg_type, result);
+	}
+	if (!IsComparable(target.GetType(), target_pg_type)) {
+		return false;
+	}
+	return TryTransformExpression(expr, columns, result);
+}
+
+static bool TryTransformRelation(PhysicalOperator &op, PostgresCatalog &catalog, PushdownRelation &result) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &table_scan = op.Cast<PhysicalTableScan>();
+		if (!PostgresCatalog::IsPostgresScan(table_scan.function.name)) {
+			return false;
+		}
+		auto &bind_data = table_scan.bind_data->Cast<PostgresBindData>();
+		if (bind_data.GetCatalog().get() != &catalog || !bind_data.sql.empty() || bind_data.table_name.empty()) {
+			// postgres_query or a scan of a different database
+			return false;
+		}
+		result.bind_data = &bind_data;
+		vector<PushdownColumn> scan_columns;
+		for (auto &column_id : table_scan.column_ids) {
+			PushdownColumn column;
+			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+				column.sql = "ctid";
+				column.is_ctid = true;
+			} else {
+				column.sql = KeywordHelper::WriteQuoted(bind_data.names[column_id], '"');
+				column.is_comparable = IsComparable(bind_data.types[column_id], bind_data.postgres_types[column_id]);
+				column.oid = bind_data.postgres_types[column_id].oid;
+			}
+			scan_columns.push_back(std::move(column));
+		}
+		if (table_scan.projection_ids.empty()) {
+			result.columns = std::move(scan_columns);
+		} else {
+			for (auto &projection_id : table_scan.projection_ids) {
+				result.columns.push_back(scan_columns[projection_id]);
+			}
+		}
+		if (table_scan.table_filters && !table_scan.table_filters->filters.empty()) {
+			result.filters.push_back(PostgresFilterPushdown::TransformFilters(
+			    table_scan.column_ids, table_scan.table_filters.get(), bind_data.names));
+		}
+		return true;
+	}
+	case PhysicalOperatorType::FILTER: {
+		auto &filter = op.Cast<PhysicalFilter>();
+		if (!TryTransformRelation(*op.children[0], catalog, result)) {
+			return false;
+		}
+		string filter_sql;
+		if (!TryTransformExpression(*filter.expression, result.columns, filter_sql)) {
+			return false;
+		}
+		result.filters.push_back(std::move(filter_sql));
+		return true;
+	}
+	case PhysicalOperatorType::PROJECTION: {
+		auto &projection = op.Cast<PhysicalProjection>();
+		if (!TryTransformRelation(*op.children[0], catalog, result)) {
+			return false;
+		}
+		vector<PushdownColumn> projected_columns;
+		for (auto &expr : projection.select_list) {
+			if (expr->GetExpressionClass() == ExpressionClass::BOUND_REF) {
+				projected_columns.push_back(result.columns[expr->Cast<BoundReferenceExpression>().index]);
+				continue;
+			}
+			PushdownColumn column;
+			if (!TryTransformExpression(*expr, result.columns, column.sql)) {
+				return false;
+			}
+			projected_columns.push_back(std::move(column));
+		}
+		result.columns = std::move(projected_columns);
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool DMLPushdownEnabled(ClientContext &context) {
+	Value dml_pushdown;
+	if (context.TryGetCurrentSetting("pg_dml_pushdown", dml_pushdown)) {
+		return BooleanValue::Get(dml_pushdown);
+	}
+	return true;
+}
+
+static bool IsTargetTable(const PushdownRelation &relation, TableCatalogEntry &table) {
+	return relation.bind_data->schema_name == table.schema.name && relation.bind_data->table_name == table.name;
+}
+
+unique_ptr<PhysicalOperator> PostgresDMLPushdown::TryPlanInsert(ClientContext &context, LogicalInsert &op,
+                                                                PhysicalOperator &plan) {
+	if (!DMLPushdownEnabled(context)) {
+		return nullptr;
+	}
+	auto &catalog = op.table.catalog.Cast<PostgresCatalog>();
+	PushdownRelation relation;
+	if (!TryTransformRelation(plan, catalog, relation)) {
+		return nullptr;
+	}
+	auto &table = op.table.Cast<PostgresTableEntry>();
+	auto &columns = table.GetColumns();
+	// figure out which column each of the inserted values is written to
+	vector<idx_t> column_indexes;
+	if (op.column_index_map.empty()) {
+		for (idx_t c = 0; c < columns.LogicalColumnCount(); c++) {
+			column_indexes.push_back(c);
+		}
+	} else {
+		column_indexes.resize(columns.LogicalColumnCount(), DConstants::INVALID_INDEX);
+		idx_t column_count = 0;
+		for (idx_t c = 0; c < op.column_index_map.size(); c++) {
+			auto mapped_index = op.column_index_map[PhysicalIndex(c)];
+			if (mapped_index == DConstants::INVALID_INDEX) {
+				continue;
+			}
+			column_indexes[mapped_index] = c;
+			column_count++;
+		}
+		column_indexes.resize(column_count);
+	}
+	if (column_indexes.size() != relation.columns.size()) {
+		return nullptr;
+	}
+	vector<string> column_names;
+	vector<string> values;
+	for (idx_t c = 0; c < column_indexes.size(); c++) {
+		auto column_index = column_indexes[c];
+		string value_sql;
+		if (!TryTransformColumnValue(relation.columns[c], columns.GetColumn(LogicalIndex(column_index)),
+		                             table.postgres_types[column_index], value_sql)) {
+			return nullptr;
+		}
+		column_names.push_back(KeywordHelper::WriteQuoted(table.postgres_names[column_index], '"'));
+		values.push_back(std::move(value_sql));
+	}
+	string sql = "INSERT INTO ";
+	sql += KeywordHelper::WriteQuoted(table.schema.name, '"') + ".";
+	sql += KeywordHelper::WriteQuoted(table.name, '"');
+	sql += " (" + StringUtil::Join(column_names, ", ") + ")";
+	sql += " SELECT " + StringUtil::Join(values, ", ");
+	sql += " FROM " + relation.GetTableName();
+	sql += relation.GetWhereClause();
+	return make_uniq<PostgresDMLPushdown>(op, op.table, std::move(sql));
+}
+
+unique_ptr<PhysicalOperator> PostgresDMLPushdown::TryPlanUpdate(ClientContext &context, LogicalUpdate &op,
+                                                                PhysicalOperator &plan) {
+	if (!DMLPushdownEnabled(context)) {
+		return nullptr;
+	}
+	auto &catalog = op.table.catalog.Cast<PostgresCatalog>();
+	PushdownRelation relation;
+	if (!TryTransformRelation(plan, catalog, relation) || !IsTargetTable(relation, op.table)) {
+		return nullptr;
+	}
+	// the row ids are the last column of the input
+	if (relation.columns.empty() || !relation.columns.back().is_ctid) {
+		return nullptr;
+	}
+	auto &table = op.table.Cast<PostgresTableEntry>();
+	vector<string> set_list;
+	for (idx_t i = 0; i < op.columns.size(); i++) {
+		auto column_index = op.columns[i].index;
+		string value_sql;
+		if (!TryTransformValue(*op.expressions[i], relation.columns, table.GetColumn(LogicalIndex(column_index)),
+		                       table.postgres_types[column_index], value_sql)) {
+			return nullptr;
+		}
+		auto &column_name = table.postgres_names[column_index];
+		set_list.push_back(KeywordHelper::WriteQuoted(column_name, '"') + " = " + value_sql);
+	}
+	string sql = "UPDATE " + relation.GetTableName();
+	sql += " SET " + StringUtil::Join(set_list, ", ");
+	sql += relation.GetWhereClause();
+	return make_uniq<PostgresDMLPushdown>(op, op.table, std::move(sql));
+}
+
+unique_ptr<PhysicalOperator> PostgresDMLPushdown::TryPlanDelete(ClientContext &context, LogicalDelete &op,
+                                                                PhysicalOperator &plan) {
+	if (!DMLPushdownEnabled(context)) {
+		return nullptr;
+	}
+	auto &catalog = op.table.catalog.Cast<PostgresCatalog>();
+	PushdownRelation relation;
+	if (!TryTransformRelation(plan, catalog, relation) || !IsTargetTable(relation, op.table)) {
+		return nullptr;
+	}
+	auto &row_id_ref = op.expressions[0]->Cast<BoundReferenceExpression>();
+	if (!relation.columns[row_id_ref.index].is_ctid) {
+		return nullptr;
+	}
+	string sql = "DELETE FROM " + relation.GetTableName();
+	sql += relation.GetWhereClause();
+	return make_uniq<PostgresDMLPushdown>(op, op.table, std::move(sql));
+}
+
+//===--------------------------------------------------------------------===//
+// GetData
+//===--------------------------------------------------------------------===//
+SourceResultType PostgresDMLPushdown::GetData(ExecutionContext &context, DataChunk &chunk,
+                                              OperatorSourceInput &input) const {
+	auto &transaction = PostgresTransaction::Get(context.client, table.catalog);
+	transaction.AddWrittenTable(table.schema.name, table.name);
+	auto result = transaction.Query(sql);
+	chunk.SetCardinality(1);
+	chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(result->AffectedRows())));
+	return SourceResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// Helpers
+//===--------------------------------------------------------------------===//
+string PostgresDMLPushdown::GetName() const {
+	return "PG_DML_PUSHDOWN";
+}
+
+InsertionOrderPreservingMap<string> PostgresDMLPushdown::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Table Name"] = table.name;
+	result["SQL"] = sql;
+	return result;
+}
+
+} // namespace duckdb
@@ -1,4 +1,5 @@
 #include "storage/postgres_insert.hpp"
+#include "storage/postgres_dml_pushdown.hpp"
 #include "storage/postgres_catalog.hpp"
 #include "storage/postgres_transaction.hpp"
 #include "duckdb/planner/operator/logical_insert.hpp"
@@ -77,22 +78,33 @@ unique_ptr<GlobalSinkState> PostgresInsert::GetGlobalSinkState(ClientContext &co
 	}
 	auto &transaction = PostgresTransaction::Get(context, insert_table->catalog);
 	auto &connection = transaction.GetConnection();
+	transaction.AddWrittenTable(insert_table->schema.name, insert_table->name);
 	auto insert_columns = GetInsertColumns(*this, *insert_table);
 	auto result = make_uniq<PostgresInsertGlobalState>(context, insert_table);
 	auto format = insert_table->GetCopyFormat(context);
 	vector<string> insert_column_names;
+	vector<PostgresType> insert_column_types;
+	bool has_column_types = true;
 	if (!insert_columns.empty()) {
 		for (auto &str : insert_columns) {
 			auto index = insert_table->GetColumnIndex(str, true);
 			if (!index.IsValid()) {
 				insert_column_names.push_back(str);
+				has_column_types = false;
 			} else {
 				insert_column_names.push_back(insert_table->postgres_names[index.index]);
+				insert_column_types.push_back(insert_table->postgres_types[index.index]);
 			}
 		}
+	} else {
+		insert_column_types = insert_table->postgres_types;
 	}
 	connection.BeginCopyTo(context, result->copy_state, format, insert_table->schema.name, insert_table->name,
 	                       insert_column_names);
+	if (has_column_types) {
+		// the binary writer uses the catalog types to write composite types, arrays and annotated types
+		result->copy_state.column_types = std::move(insert_column_types);
+	}
 	return std::move(result);
 }
 
@@ -203,6 +215,7 @@ void PostgresCatalog::MaterializePostgresScans(PhysicalOperator &op) {
 			bind_data.max_threads = 1;
 			bind_data.can_use_main_thread = true;
 			bind_data.emit_ctid = true;
+			bind_data.can_stream_from_snapshot = bind_data.sql.empty();
 		}
 	}
 	for (auto &child : op.children) {
@@ -218,6 +231,10 @@ unique_ptr<PhysicalOperator> PostgresCatalog::PlanInsert(ClientContext &context,
 	if (op.action_type != OnConflictAction::THROW) {
 		throw BinderException("ON CONFLICT clause not yet supported for insertion into Postgres table");
 	}
+	auto pushdown = PostgresDMLPushdown::TryPlanInsert(context, op, *plan);
+	if (pushdown) {
+		return pushdown;
+	}
 	MaterializePostgresScans(*plan);
 
 	plan = AddCastToPostgresTypes(context, std::move(plan));
@@ -5,6 +5,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "storage/postgres_catalog.hpp"
 #include "postgres_scanner.hpp"
+#include "postgres_filter_pushdown.hpp"
 
 namespace duckdb {
 
@@ -34,6 +35,51 @@ void GatherPostgresScans(LogicalOperator &op, PostgresOperators &result) {
 	}
 }
 
+//! Group scans of the same table - scans within the same transaction read the same snapshot, so they can share a
+//! single remote scan
+static vector<vector<reference<LogicalGet>>> GroupDuplicateScans(vector<reference<LogicalGet>> &scans,
+                                                                 bool share_scans) {
+	vector<vector<reference<LogicalGet>>> result;
+	case_insensitive_map_t<idx_t> table_groups;
+	for (auto &scan : scans) {
+		auto &bind_data = scan.get().bind_data->Cast<PostgresBindData>();
+		if (!share_scans || bind_data.table_name.empty() || bind_data.use_replica) {
+			result.emplace_back();
+			result.back().push_back(scan);
+			continue;
+		}
+		auto key = bind_data.schema_name + "." + bind_data.table_name + (bind_data.emit_ctid ? ".ctid" : "");
+		auto entry = table_groups.find(key);
+		if (entry == table_groups.end()) {
+			table_groups[key] = result.size();
+			result.emplace_back();
+			result.back().push_back(scan);
+		} else {
+			result[entry->second].push_back(scan);
+		}
+	}
+	return result;
+}
+
+//! Share a single remote scan between the scans - the remote scan reads the union of their columns and filters
+static void ShareScan(vector<reference<LogicalGet>> &scans) {
+	auto shared_scan = make_shared_ptr<PostgresSharedScan>();
+	for (idx_t scan_idx = 0; scan_idx < scans.size(); scan_idx++) {
+		auto &get = scans[scan_idx].get();
+		auto &bind_data = get.bind_data->Cast<PostgresBindData>();
+		for (auto &column_id : get.column_ids) {
+			auto entry = std::find(shared_scan->column_ids.begin(), shared_scan->column_ids.end(), column_id);
+			if (entry == shared_scan->column_ids.end()) {
+				shared_scan->column_ids.push_back(column_id);
+			}
+		}
+		shared_scan->filters.push_back(
+		    PostgresFilterPushdown::TransformFilters(get.column_ids, &get.table_filters, bind_data.names));
+		bind_data.shared_scan = shared_scan;
+		bind_data.shared_scan_idx = scan_idx;
+	}
+}
+
 void PostgresOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
 	// look at the query plan and check if we can enable streaming query scans
 	PostgresOperators operators;
@@ -42,15 +88,29 @@ void PostgresOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<Logi
 		// no scans
 		return;
 	}
+	Value share_scans;
+	if (!input.context.TryGetCurrentSetting("pg_share_duplicate_scans", share_scans)) {
+		share_scans = Value::BOOLEAN(false);
+	}
 	for (auto &entry : operators.scans) {
 		auto &catalog = entry.first;
-		auto multiple_scans = entry.second.size() > 1;
-		for (auto &scan : entry.second) {
+		auto scan_groups = GroupDuplicateScans(entry.second, BooleanValue::Get(share_scans));
+		vector<reference<LogicalGet>> remote_scans;
+		for (auto &group : scan_groups) {
+			if (group.size() > 1) {
+				ShareScan(group);
+			}
+			remote_scans.push_back(group[0]);
+		}
+		auto multiple_scans = remote_scans.size() > 1;
+		for (auto &scan : remote_scans) {
 			auto &bind_data = scan.get().bind_data->Cast<PostgresBindData>();
 			// if there is a single scan in the plan we can always stream using the main thread
 			// if there is more than one scan we either (1) need to materialize, or (2) cannot use the main thread
+			// as long as the transaction has not written anything we can stream on separate connections that share the
+			// snapshot of the transaction
 			if (multiple_scans) {
-				if (bind_data.max_threads > 1 && bind_data.read_only) {
+				if (bind_data.read_only) {
 					bind_data.requires_materialization = false;
 					bind_data.can_use_main_thread = false;
 				} else {
@@ -0,0 +1,28 @@
+#include "storage/postgres_query_cache.hpp"
+
+namespace duckdb {
+
+shared_ptr<PostgresQueryDescription> PostgresQueryCache::Get(const string &sql) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(sql);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+void PostgresQueryCache::Insert(const string &sql, shared_ptr<PostgresQueryDescription> description) {
+	lock_guard<mutex> guard(lock);
+	if (entries.size() >= MAX_ENTRIES) {
+		// the queries are most likely generated (e.g. with inlined values) - start over rather than growing unbounded
+		entries.clear();
+	}
+	entries[sql] = std::move(description);
+}
+
+void PostgresQueryCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+}
+
+} // namespace duckdb
@@ -0,0 +1,200 @@
+#include "storage/postgres_replica_cache.hpp"
+#include "duckdb/main/appender.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "postgres_utils.hpp"
+
+namespace duckdb {
+
+bool PostgresReplicaVersion::operator==(const PostgresReplicaVersion &other) const {
+	return relfilenode == other.relfilenode && tuples_inserted == other.tuples_inserted &&
+	       tuples_updated == other.tuples_updated && tuples_deleted == other.tuples_deleted &&
+	       signature == other.signature;
+}
+
+bool PostgresReplicaVersion::IsAppendOnly(const PostgresReplicaVersion &other) const {
+	return relfilenode == other.relfilenode && tuples_inserted >= other.tuples_inserted &&
+	       tuples_updated == other.tuples_updated && tuples_deleted == other.tuples_deleted &&
+	       signature == other.signature;
+}
+
+static void CheckResult(QueryResult &result) {
+	if (result.HasError()) {
+		result.ThrowError("Failed to access Postgres replica cache: ");
+	}
+}
+
+PostgresReplicaCache::PostgresReplicaCache(const string &path, string append_key_p, DBConfig &config)
+    : db(path, &config), con(db), append_key(std::move(append_key_p)) {
+	auto result = con.Query("CREATE TABLE IF NOT EXISTS __postgres_replica(schema_name VARCHAR, table_name VARCHAR, "
+	                        "local_name VARCHAR, relfilenode BIGINT, tuples_inserted BIGINT, tuples_updated BIGINT, "
+	                        "tuples_deleted BIGINT, signature VARCHAR, last_key VARCHAR, "
+	                        "PRIMARY KEY (schema_name, table_name))");
+	CheckResult(*result);
+}
+
+static string GetTableKey(const string &schema_name, const string &table_name) {
+	return KeywordHelper::WriteQuoted(schema_name, '"') + "." + KeywordHelper::WriteQuoted(table_name, '"');
+}
+
+shared_ptr<PostgresReplicaTable> PostgresReplicaCache::GetTable(const string &schema_name, const string &table_name) {
+	lock_guard<mutex> guard(lock);
+	auto entry = tables.find(GetTableKey(schema_name, table_name));
+	if (entry != tables.end()) {
+		return entry->second;
+	}
+	// not loaded yet - check if the table is stored in the local database
+	auto table = LoadTable(schema_name, table_name);
+	if (table) {
+		tables[GetTableKey(schema_name, table_name)] = table;
+	}
+	return table;
+}
+
+shared_ptr<PostgresReplicaTable> PostgresReplicaCache::LoadTable(const string &schema_name, const string &table_name) {
+	auto statement = con.Prepare("SELECT local_name, relfilenode, tuples_inserted, tuples_updated, tuples_deleted, "
+	                             "signature, last_key FROM __postgres_replica WHERE schema_name=$1 AND table_name=$2");
+	auto result = statement->Execute(schema_name, table_name);
+	CheckResult(*result);
+	auto &metadata = result->Cast<MaterializedQueryResult>();
+	if (metadata.RowCount() == 0) {
+		return nullptr;
+	}
+	auto table = make_shared_ptr<PostgresReplicaTable>();
+	auto local_name = metadata.GetValue(0, 0).ToString();
+	table->version.relfilenode = metadata.GetValue(1, 0).GetValue<int64_t>();
+	table->version.tuples_inserted = metadata.GetValue(2, 0).GetValue<int64_t>();
+	table->version.tuples_updated = metadata.GetValue(3, 0).GetValue<int64_t>();
+	table->version.tuples_deleted = metadata.GetValue(4, 0).GetValue<int64_t>();
+	table->version.signature = metadata.GetValue(5, 0).ToString();
+	table->last_key = metadata.GetValue(6, 0);
+	table->local_name = std::move(local_name);
+	return table;
+}
+
+unique_ptr<PostgresReplicaScan> PostgresReplicaCache::ScanTable(const PostgresReplicaTable &table,
+                                                                const vector<column_t> &column_ids) {
+	string columns;
+	for (auto column_id : column_ids) {
+		if (!columns.empty()) {
+			columns += ", ";
+		}
+		columns += "c" + to_string(column_id);
+	}
+	// every scan gets its own connection - so that scans can run while other tables are being refreshed
+	auto scan = make_uniq<PostgresReplicaScan>();
+	scan->connection = make_uniq<Connection>(db);
+	scan->result = scan->connection->SendQuery(
+	    StringUtil::Format("SELECT %s FROM %s", columns, KeywordHelper::WriteQuoted(table.local_name, '"')));
+	CheckResult(*scan->result);
+	return scan;
+}
+
+void PostgresReplicaCache::InvalidateTable(const string &schema_name, const string &table_name) {
+	lock_guard<mutex> guard(lock);
+	// a relfilenode that no table has forces a full refresh - the statistics might not reflect the writes yet
+	auto statement =
+	    con.Prepare("UPDATE __postgres_replica SET relfilenode=-1 WHERE schema_name=$1 AND table_name=$2");
+	CheckResult(*statement->Execute(schema_name, table_name));
+	tables.erase(GetTableKey(schema_name, table_name));
+}
+
+void PostgresReplicaCache::InvalidateTables() {
+	lock_guard<mutex> guard(lock);
+	CheckResult(*con.Query("UPDATE __postgres_replica SET relfilenode=-1"));
+	tables.clear();
+}
+
+string PostgresReplicaCache::GetLocalName(const string &schema_name, const string &table_name) {
+	auto statement = con.Prepare("SELECT local_name FROM __postgres_replica WHERE schema_name=$1 AND table_name=$2");
+	auto result = statement->Execute(schema_name, table_name);
+	CheckResult(*result);
+	auto &metadata = result->Cast<MaterializedQueryResult>();
+	if (metadata.RowCount() > 0) {
+		return metadata.GetValue(0, 0).ToString();
+	}
+	auto count = con.Query("SELECT COUNT(*) FROM __postgres_replica");
+	CheckResult(*count);
+	return "replica_" + count->GetValue(0, 0).ToString();
+}
+
+void PostgresReplicaCache::WriteTable(const string &local_name, ColumnDataCollection &rows, bool replace) {
+	if (replace) {
+		string columns;
+		for (idx_t c = 0; c < rows.ColumnCount(); c++) {
+			if (!columns.empty()) {
+				columns += ", ";
+			}
+			columns += "c" + to_string(c) + " " + PostgresUtils::RemoveAlias(rows.Types()[c]).ToString();
+		}
+		auto result =
+		    con.Query(StringUtil::Format("CREATE OR REPLACE TABLE %s(%s)", KeywordHelper::WriteQuoted(local_name, '"'),
+		                                 columns));
+		CheckResult(*result);
+	}
+	Appender appender(con, local_name);
+	for (auto &chunk : rows.Chunks()) {
+		appender.AppendDataChunk(chunk);
+	}
+	appender.Close();
+}
+
+void PostgresReplicaCache::WriteVersion(const string &schema_name, const string &table_name, const string &local_name,
+                                        const PostgresReplicaVersion &version, Value &last_key,
+                                        optional_idx key_column) {
+	if (key_column.IsValid()) {
+		auto result = con.Query(StringUtil::Format("SELECT MAX(c%d)::VARCHAR FROM %s", key_column.GetIndex(),
+		                                           KeywordHelper::WriteQuoted(local_name, '"')));
+		CheckResult(*result);
+		last_key = result->GetValue(0, 0);
+	} else {
+		last_key = Value();
+	}
+	auto statement =
+	    con.Prepare("INSERT OR REPLACE INTO __postgres_replica VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9)");
+	auto result = statement->Execute(schema_name, table_name, local_name, version.relfilenode, version.tuples_inserted,
+	                                 version.tuples_updated, version.tuples_deleted, version.signature, last_key);
+	CheckResult(*result);
+}
+
+shared_ptr<PostgresReplicaTable> PostgresReplicaCache::WriteReplica(const string &schema_name,
+                                                                    const string &table_name,
+                                                                    PostgresReplicaVersion version,
+                                                                    ColumnDataCollection &rows, optional_idx key_column,
+                                                                    bool replace) {
+	auto table = make_shared_ptr<PostgresReplicaTable>();
+	table->version = std::move(version);
+	con.BeginTransaction();
+	try {
+		table->local_name = GetLocalName(schema_name, table_name);
+		WriteTable(table->local_name, rows, replace);
+		WriteVersion(schema_name, table_name, table->local_name, table->version, table->last_key, key_column);
+		con.Commit();
+	} catch (...) {
+		con.Rollback();
+		throw;
+	}
+	tables[GetTableKey(schema_name, table_name)] = table;
+	return table;
+}
+
+shared_ptr<PostgresReplicaTable> PostgresReplicaCache::StoreTable(const string &schema_name, const string &table_name,
+                                                                  PostgresReplicaVersion version,
+                                                                  ColumnDataCollection &rows, optional_idx key_column) {
+	lock_guard<mutex> guard(lock);
+	return WriteReplica(schema_name, table_name, std::move(version), rows, key_column, true);
+}
+
+shared_ptr<PostgresReplicaTable> PostgresReplicaCache::AppendTable(const string &schema_name,
+                                                                   const string &table_name,
+                                                                   PostgresReplicaVersion version,
+                                                                   ColumnDataCollection &rows,
+                                                                   optional_idx key_column) {
+	lock_guard<mutex> guard(lock);
+	if (tables.find(GetTableKey(schema_name, table_name)) == tables.end()) {
+		throw InternalException("Appending to Postgres replica of table that has not been loaded");
+	}
+	// running scans read through their own connection - they keep seeing the rows of the previous version
+	return WriteReplica(schema_name, table_name, std::move(version), rows, key_column, false);
+}
+
+} // namespace duckdb
@@ -0,0 +1,45 @@
+#include "storage/postgres_scan_cache.hpp"
+
+namespace duckdb {
+
+shared_ptr<ColumnDataCollection> PostgresScanCache::Get(const string &key) {
+	lock_guard<mutex> guard(lock);
+	for (auto &entry : entries) {
+		if (entry.first == key) {
+			return entry.second;
+		}
+	}
+	return nullptr;
+}
+
+void PostgresScanCache::Insert(const string &key, shared_ptr<ColumnDataCollection> collection, idx_t max_size) {
+	auto size = collection->SizeInBytes();
+	if (size > max_size) {
+		// the scan result does not fit in the cache
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	for (auto &entry : entries) {
+		if (entry.first == key) {
+			// another scan has already cached the same result
+			return;
+		}
+	}
+	// evict the oldest entries until the scan result fits
+	idx_t evict_count = 0;
+	while (total_size + size > max_size) {
+		total_size -= entries[evict_count].second->SizeInBytes();
+		evict_count++;
+	}
+	entries.erase(entries.begin(), entries.begin() + NumericCast<int64_t>(evict_count));
+	entries.emplace_back(key, std::move(collection));
+	total_size += size;
+}
+
+void PostgresScanCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	total_size = 0;
+}
+
+} // namespace duckdb
@@ -50,13 +50,21 @@ TableFunction PostgresTableEntry::GetScanFunction(ClientContext &context, unique
 	}
 	result->names = postgres_names;
 	result->postgres_types = postgres_types;
-	result->read_only = transaction.IsReadOnly();
+	// scans can only run on other connections while the transaction has not written anything
+	result->read_only = !transaction.HasWrites();
+	// the local replica holds the latest committed state of the table (according to the table statistics) - not the
+	// snapshot of the transaction - so it is only used by auto-commit statements that do not see their own writes
+	// explicit transactions always read from Postgres, so that all their reads come from the same snapshot
+	result->use_replica = pg_catalog.GetReplicaCache() && context.transaction.IsAutoCommit() && result->read_only &&
+	                      !result->types.empty();
 	PostgresScanFunction::PrepareBind(pg_catalog.GetPostgresVersion(), context, *result, approx_num_pages);
 
+	auto use_replica = result->use_replica;
 	bind_data = std::move(result);
 	auto function = PostgresScanFunction();
 	Value filter_pushdown;
-	if (context.TryGetCurrentSetting("pg_experimental_filter_pushdown", filter_pushdown)) {
+	if (!use_replica && context.TryGetCurrentSetting("pg_experimental_filter_pushdown", filter_pushdown)) {
+		// filters cannot be pushed into scans of the local replica
 		function.filter_pushdown = BooleanValue::Get(filter_pushdown);
 	}
 	return function;
@@ -72,31 +80,44 @@ TableStorageInfo PostgresTableEntry::GetStorageInfo(ClientContext &context) {
 }
 
 static bool CopyRequiresText(const LogicalType &type, const PostgresType &pg_type) {
-	if (pg_type.info != PostgresTypeAnnotation::STANDARD) {
+	switch (pg_type.info) {
+	case PostgresTypeAnnotation::CAST_TO_VARCHAR:
+	case PostgresTypeAnnotation::CTID:
+		// we do not know the binary layout of these types
 		return true;
+	case PostgresTypeAnnotation::GEOM_PATH:
+		// whether or not a path is closed is not read - the binary format would have to make it up
+		return true;
+	default:
+		break;
 	}
+	uint32_t oid;
 	switch (type.id()) {
 	case LogicalTypeId::LIST: {
+		if (!PostgresUtils::IsPostgresArray(type, pg_type)) {
+			// geometric type
+			return false;
+		}
 		D_ASSERT(pg_type.children.size() == 1);
 		auto &child_type = ListType::GetChildType(type);
-		if (child_type.id() != LogicalTypeId::LIST) {
-			if (!PostgresUtils::SupportedPostgresOid(child_type)) {
+		auto &child_pg_type = pg_type.children[0];
+		if (!PostgresUtils::IsPostgresArray(child_type, child_pg_type)) {
+			// the array header requires the oid of the element type
+			if (!PostgresUtils::TryGetPostgresOid(child_type, child_pg_type, oid)) {
 				return true;
 			}
-			if (pg_type.children[0].oid != PostgresUtils::ToPostgresOid(child_type)) {
-				return true;
-			}
-		}
-		if (CopyRequiresText(child_type, pg_type.children[0])) {
-			return true;
 		}
-		return false;
+		return CopyRequiresText(child_type, child_pg_type);
 	}
 	case LogicalTypeId::STRUCT: {
+		if (pg_type.info == PostgresTypeAnnotation::GEOM_POINT) {
+			return false;
+		}
 		auto &children = StructType::GetChildTypes(type);
 		D_ASSERT(children.size() == pg_type.children.size());
 		for (idx_t c = 0; c < pg_type.children.size(); c++) {
-			if (!PostgresUtils::SupportedPostgresOid(children[c].second)) {
+			// composite types require the exact oid of every field
+			if (!PostgresUtils::TryGetPostgresOid(children[c].second, pg_type.children[c], oid)) {
 				return true;
 			}
 			if (CopyRequiresText(children[c].second, pg_type.children[c])) {
@@ -110,16 +131,47 @@ static bool CopyRequiresText(const LogicalType &type, const PostgresType &pg_typ
 	}
 }
 
+PostgresTableEntry &PostgresTableEntry::Lookup(ClientContext &context, const string &function_name,
+                                               const string &name) {
+	auto parts = StringUtil::SplitWithQuote(name, '.');
+	if (parts.size() < 2 || parts.size() > 3) {
+		throw BinderException("%s: table \"%s\" must be of the form database.table or database.schema.table",
+		                      function_name, name);
+	}
+	auto &db_name = parts[0];
+	auto schema_name = parts.size() == 3 ? parts[1] : string(DEFAULT_SCHEMA);
+	auto &catalog = Catalog::GetCatalog(context, db_name);
+	if (catalog.GetCatalogType() != "postgres") {
+		throw BinderException("Attached database \"%s\" does not refer to a Postgres database", db_name);
+	}
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, db_name, schema_name, parts.back());
+	return table.Cast<PostgresTableEntry>();
+}
+
 PostgresCopyFormat PostgresTableEntry::GetCopyFormat(ClientContext &context) {
+	vector<PhysicalIndex> column_indexes;
+	for (idx_t c = 0; c < postgres_types.size(); c++) {
+		column_indexes.emplace_back(c);
+	}
+	return GetCopyFormat(context, column_indexes);
+}
+
+bool PostgresTableEntry::UseBinaryCopy(ClientContext &context) {
 	Value use_binary_copy;
 	if (context.TryGetCurrentSetting("pg_use_binary_copy", use_binary_copy)) {
-		if (!BooleanValue::Get(use_binary_copy)) {
-			return PostgresCopyFormat::TEXT;
-		}
+		return BooleanValue::Get(use_binary_copy);
+	}
+	return true;
+}
+
+PostgresCopyFormat PostgresTableEntry::GetCopyFormat(ClientContext &context,
+                                                     const vector<PhysicalIndex> &column_indexes) {
+	if (!UseBinaryCopy(context)) {
+		return PostgresCopyFormat::TEXT;
 	}
 	D_ASSERT(postgres_types.size() == columns.LogicalColumnCount());
-	for (idx_t c = 0; c < postgres_types.size(); c++) {
-		if (CopyRequiresText(columns.GetColumn(LogicalIndex(c)).GetType(), postgres_types[c])) {
+	for (auto &index : column_indexes) {
+		if (CopyRequiresText(columns.GetColumn(LogicalIndex(index.index)).GetType(), postgres_types[index.index])) {
 			return PostgresCopyFormat::TEXT;
 		}
 	}
@@ -1,5 +1,6 @@
 #include "storage/postgres_table_set.hpp"
 #include "storage/postgres_transaction.hpp"
+#include "storage/postgres_catalog.hpp"
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
 #include "duckdb/parser/constraints/not_null_constraint.hpp"
 #include "duckdb/parser/constraints/unique_constraint.hpp"
@@ -22,19 +23,22 @@ PostgresTableSet::PostgresTableSet(PostgresSchemaEntry &schema, unique_ptr<Postg
 string PostgresTableSet::GetInitializeQuery(const string &schema, const string &table) {
 	string base_query = R"(
 SELECT pg_namespace.oid AS namespace_id, relname, relpages, attname,
-    pg_type.typname type_name, atttypmod type_modifier, pg_attribute.attndims ndim,
-    attnum, pg_attribute.attnotnull AS notnull, NULL constraint_id,
-    NULL constraint_type, NULL constraint_key
+    COALESCE(base_type.typname, pg_type.typname) type_name,
+    CASE WHEN base_type.oid IS NULL THEN atttypmod ELSE pg_type.typtypmod END type_modifier,
+    pg_attribute.attndims ndim, attnum, pg_attribute.attnotnull AS notnull, NULL constraint_id,
+    NULL constraint_type, NULL constraint_key,
+    COALESCE(base_type.oid, pg_type.oid) type_oid, COALESCE(base_type.typelem, pg_type.typelem) element_oid
 FROM pg_class
 JOIN pg_namespace ON relnamespace = pg_namespace.oid
 JOIN pg_attribute ON pg_class.oid=pg_attribute.attrelid
 JOIN pg_type ON atttypid=pg_type.oid
+LEFT JOIN pg_type base_type ON pg_type.typtype='d' AND pg_type.typbasetype=base_type.oid
 WHERE attnum > 0 AND relkind IN ('r', 'v', 'm', 'f', 'p') ${CONDITION}
 UNION ALL
 SELECT pg_namespace.oid AS namespace_id, relname, NULL relpages, NULL attname, NULL type_name,
     NULL type_modifier, NULL ndim, NULL attnum, NULL AS notnull,
     pg_constraint.oid AS constraint_id, contype AS constraint_type,
-    conkey AS constraint_key
+    conkey AS constraint_key, NULL type_oid, NULL element_oid
 FROM pg_class
 JOIN pg_namespace ON relnamespace = pg_namespace.oid
 JOIN pg_constraint ON (pg_class.oid=pg_constraint.conrelid)
@@ -61,10 +65,13 @@ void PostgresTableSet::AddColumn(optional_ptr<PostgresTransaction> transaction,
 	type_info.type_modifier = result.GetInt64(row, column_index + 2);
 	type_info.array_dimensions = result.GetInt64(row, column_index + 3);
 	bool is_not_null = result.GetBool(row, column_index + 5);
+	auto type_oid = result.GetInt64(row, column_index + 9);
+	auto element_oid = result.GetInt64(row, column_index + 10);
 	string default_value;
 
 	PostgresType postgres_type;
 	auto column_type = PostgresUtils::TypeToLogicalType(transaction, schema, type_info, postgres_type);
+	PostgresUtils::SetPostgresOids(column_type, postgres_type, type_oid, element_oid);
 	table_info.postgres_types.push_back(std::move(postgres_type));
 	table_info.postgres_names.push_back(column_name);
 	ColumnDefinition column(std::move(column_name), std::move(column_type));
@@ -410,6 +417,7 @@ void PostgresTableSet::AlterTable(ClientContext &context, AlterTableInfo &alter)
 		                      "ADD COLUMN and DROP COLUMN");
 	}
 	ClearEntries();
+	catalog.Cast<PostgresCatalog>().GetQueryCache().Clear();
 }
 
 } // namespace duckdb
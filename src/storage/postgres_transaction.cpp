@@ -1,16 +1,22 @@
 #include "storage/postgres_transaction.hpp"
 #include "storage/postgres_catalog.hpp"
+#include "storage/postgres_replica_cache.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "postgres_result.hpp"
+#include "duckdb/main/client_context.hpp"
 
 namespace duckdb {
 
 PostgresTransaction::PostgresTransaction(PostgresCatalog &postgres_catalog, TransactionManager &manager,
                                          ClientContext &context)
-    : Transaction(manager, context), access_mode(postgres_catalog.access_mode) {
-	connection = postgres_catalog.GetConnectionPool().GetConnection();
+    : Transaction(manager, context), postgres_catalog(postgres_catalog), access_mode(postgres_catalog.access_mode) {
+	connection = postgres_catalog.GetConnectionPool().GetConnection(PostgresConnectionPool::GetAcquireTimeout(context));
+	Value autocommit_reads;
+	if (context.transaction.IsAutoCommit() && context.TryGetCurrentSetting("pg_autocommit_reads", autocommit_reads)) {
+		autocommit = BooleanValue::Get(autocommit_reads);
+	}
 }
 
 PostgresTransaction::~PostgresTransaction() = default;
@@ -21,13 +27,37 @@ void PostgresTransaction::Start() {
 void PostgresTransaction::Commit() {
 	if (transaction_state == PostgresTransactionState::TRANSACTION_STARTED) {
 		transaction_state = PostgresTransactionState::TRANSACTION_FINISHED;
-		GetConnectionRaw().Execute("COMMIT");
+		auto &con = GetConnectionRaw();
+		if (con.HasPendingStatements()) {
+			// the BEGIN has not been sent yet - there is nothing to commit
+			con.DiscardPendingStatements();
+			return;
+		}
+		con.Execute("COMMIT");
+		// the statistics of the written tables are flushed asynchronously - they cannot be used to detect the writes
+		auto replica_cache = postgres_catalog.GetReplicaCache();
+		if (!replica_cache) {
+			return;
+		}
+		if (has_writes) {
+			// postgres_execute can have written to any table
+			replica_cache->InvalidateTables();
+			return;
+		}
+		for (auto &table : written_tables) {
+			replica_cache->InvalidateTable(table.first, table.second);
+		}
 	}
 }
 void PostgresTransaction::Rollback() {
 	if (transaction_state == PostgresTransactionState::TRANSACTION_STARTED) {
 		transaction_state = PostgresTransactionState::TRANSACTION_FINISHED;
-		GetConnectionRaw().Execute("ROLLBACK");
+		auto &con = GetConnectionRaw();
+		if (con.HasPendingStatements()) {
+			con.DiscardPendingStatements();
+			return;
+		}
+		con.Execute("ROLLBACK");
 	}
 }
 
@@ -43,12 +73,19 @@ PostgresConnection &PostgresTransaction::GetConnection() {
 	auto &con = GetConnectionRaw();
 	if (transaction_state == PostgresTransactionState::TRANSACTION_NOT_YET_STARTED) {
 		transaction_state = PostgresTransactionState::TRANSACTION_STARTED;
-		string query = GetBeginTransactionQuery(access_mode);
-		con.Execute(query);
+		// the BEGIN is sent together with the first statement that runs on the connection
+		con.QueueStatement(GetBeginTransactionQuery(access_mode));
 	}
 	return con;
 }
 
+PostgresConnection &PostgresTransaction::GetAutocommitConnection() {
+	if (autocommit && transaction_state == PostgresTransactionState::TRANSACTION_NOT_YET_STARTED) {
+		return GetConnectionRaw();
+	}
+	return GetConnection();
+}
+
 PostgresConnection &PostgresTransaction::GetConnectionRaw() {
 	return connection.GetConnection();
 }
@@ -58,25 +95,11 @@ string PostgresTransaction::GetDSN() {
 }
 
 unique_ptr<PostgresResult> PostgresTransaction::Query(const string &query) {
-	auto &con = GetConnectionRaw();
-	if (transaction_state == PostgresTransactionState::TRANSACTION_NOT_YET_STARTED) {
-		transaction_state = PostgresTransactionState::TRANSACTION_STARTED;
-		string transaction_start = GetBeginTransactionQuery(access_mode);
-		transaction_start += ";\n";
-		return con.Query(transaction_start + query);
-	}
-	return con.Query(query);
+	return GetConnection().Query(query);
 }
 
 vector<unique_ptr<PostgresResult>> PostgresTransaction::ExecuteQueries(const string &queries) {
-	auto &con = GetConnectionRaw();
-	if (transaction_state == PostgresTransactionState::TRANSACTION_NOT_YET_STARTED) {
-		transaction_state = PostgresTransactionState::TRANSACTION_STARTED;
-		string transaction_start = GetBeginTransactionQuery(access_mode);
-		transaction_start += ";\n";
-		return con.ExecuteQueries(transaction_start + queries);
-	}
-	return con.ExecuteQueries(queries);
+	return GetConnection().ExecuteQueries(queries);
 }
 
 string PostgresTransaction::GetTemporarySchema() {
@@ -86,6 +109,7 @@ string PostgresTransaction::GetTemporarySchema() {
 			// no temporary tables exist yet in this connection
 			// create a random temporary table and return
 			Query("CREATE TEMPORARY TABLE __internal_temporary_table(i INTEGER)");
+			SetHasWrites();
 			result = Query("SELECT nspname FROM pg_namespace WHERE oid = pg_my_temp_schema();");
 			if (result->Count() < 1) {
 				throw BinderException("Could not find temporary schema pg_temp_NNN for this connection");
@@ -96,6 +120,28 @@ string PostgresTransaction::GetTemporarySchema() {
 	return temporary_schema;
 }
 
+bool PostgresTransaction::HasWrites() {
+	// DuckDB marks the transaction as read-write when a statement modifies the attached database
+	return has_writes || !IsReadOnly();
+}
+
+void PostgresTransaction::SetHasWrites() {
+	has_writes = true;
+	scan_cache.Clear();
+}
+
+void PostgresTransaction::AddWrittenTable(const string &schema_name, const string &table_name) {
+	written_tables.emplace_back(schema_name, table_name);
+}
+
+PostgresScanCache &PostgresTransaction::GetScanCache() {
+	if (HasWrites()) {
+		// cached scan results no longer reflect the state of the transaction
+		scan_cache.Clear();
+	}
+	return scan_cache;
+}
+
 PostgresTransaction &PostgresTransaction::Get(ClientContext &context, Catalog &catalog) {
 	return Transaction::Get(context, catalog).Cast<PostgresTransaction>();
 }
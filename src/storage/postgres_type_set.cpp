@@ -83,7 +83,8 @@ void PostgresTypeSet::InitializeEnums(PostgresResultSlice &enums) {
 
 string PostgresTypeSet::GetInitializeCompositesQuery(const string &schema) {
 	string base_query = R"(
-SELECT n.oid, t.typrelid AS id, t.typname as type, pg_attribute.attname, sub_type.typname
+SELECT n.oid, t.typrelid AS id, t.typname as type, pg_attribute.attname, sub_type.typname,
+       t.oid AS type_oid, sub_type.oid AS sub_type_oid, sub_type.typelem AS sub_type_element_oid
 FROM pg_type t
 JOIN pg_catalog.pg_namespace n ON n.oid = t.typnamespace
 JOIN pg_class ON pg_class.oid = t.typrelid
@@ -105,7 +106,7 @@ void PostgresTypeSet::CreateCompositeType(PostgresTransaction &transaction, Post
                                           idx_t end_row) {
 	PostgresType postgres_type;
 	CreateTypeInfo info;
-	postgres_type.oid = result.GetInt64(start_row, 1);
+	postgres_type.oid = result.GetInt64(start_row, 5);
 	info.name = result.GetString(start_row, 2);
 
 	child_list_t<LogicalType> child_types;
@@ -114,8 +115,11 @@ void PostgresTypeSet::CreateCompositeType(PostgresTransaction &transaction, Post
 		PostgresTypeData type_data;
 		type_data.type_name = result.GetString(row, 4);
 		PostgresType child_type;
-		child_types.push_back(
-		    make_pair(type_name, PostgresUtils::TypeToLogicalType(&transaction, &schema, type_data, child_type)));
+		auto child_logical_type = PostgresUtils::TypeToLogicalType(&transaction, &schema, type_data, child_type);
+		// the oids of the fields are required when writing composite types in binary format
+		PostgresUtils::SetPostgresOids(child_logical_type, child_type, result.GetInt64(row, 6),
+		                               result.GetInt64(row, 7));
+		child_types.push_back(make_pair(type_name, std::move(child_logical_type)));
 		postgres_type.children.push_back(std::move(child_type));
 	}
 	info.type = LogicalType::STRUCT(std::move(child_types));
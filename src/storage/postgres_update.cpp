@@ -1,4 +1,5 @@
 #include "storage/postgres_update.hpp"
+#include "storage/postgres_dml_pushdown.hpp"
 #include "storage/postgres_table_entry.hpp"
 #include "duckdb/planner/operator/logical_update.hpp"
 #include "storage/postgres_catalog.hpp"
@@ -17,32 +18,39 @@ PostgresUpdate::PostgresUpdate(LogicalOperator &op, TableCatalogEntry &table, ve
 //===--------------------------------------------------------------------===//
 class PostgresUpdateGlobalState : public GlobalSinkState {
 public:
-	explicit PostgresUpdateGlobalState(PostgresTableEntry &table) : table(table), update_count(0) {
+	explicit PostgresUpdateGlobalState(PostgresTableEntry &table) : table(table), update_count(0), batch_size(0) {
 	}
 
 	PostgresTableEntry &table;
 	PostgresCopyState copy_state;
 	DataChunk insert_chunk;
 	DataChunk varchar_chunk;
+	string update_table_name;
 	string update_sql;
 	idx_t update_count;
+	//! The maximum number of rows to update per UPDATE statement (0 = update all rows in a single statement)
+	idx_t batch_size;
 };
 
-string CreateUpdateTable(const string &name, PostgresTableEntry &table, const vector<PhysicalIndex> &index) {
+string CreateUpdateTable(const string &name, PostgresTableEntry &table, const vector<PhysicalIndex> &index,
+                         bool add_row_index) {
+	// create the table from the source table so the columns have exactly the same types as in Postgres
 	string result;
 	result = "CREATE LOCAL TEMPORARY TABLE " + KeywordHelper::WriteOptionallyQuoted(name);
-	result += "(";
+	result += " ON COMMIT DROP AS SELECT ";
 	for (idx_t i = 0; i < index.size(); i++) {
-		if (i > 0) {
-			result += ", ";
-		}
 		auto &column_name = table.postgres_names[index[i].index];
-		auto &col = table.GetColumn(LogicalIndex(index[i].index));
 		result += KeywordHelper::WriteQuoted(column_name, '"');
-		result += " ";
-		result += PostgresUtils::TypeToString(col.GetType());
+		result += ", ";
+	}
+	result += "ctid AS __page_id";
+	if (add_row_index) {
+		result += ", 0::BIGINT AS __row_index";
 	}
-	result += ", __page_id_string VARCHAR) ON COMMIT DROP;";
+	result += " FROM ";
+	result += KeywordHelper::WriteQuoted(table.schema.name, '"') + ".";
+	result += KeywordHelper::WriteQuoted(table.name, '"');
+	result += " WITH NO DATA";
 	return result;
 }
 
@@ -66,7 +74,9 @@ string GetUpdateSQL(const string &name, PostgresTableEntry &table, const vector<
 	result += " FROM " + KeywordHelper::WriteOptionallyQuoted(name);
 	result += " WHERE ";
 	result += KeywordHelper::WriteQuoted(table.name, '"');
-	result += ".ctid=__page_id_string::TID";
+	result += ".ctid=";
+	result += KeywordHelper::WriteQuoted(name, '"');
+	result += ".__page_id";
 	return result;
 }
 
@@ -76,25 +86,43 @@ unique_ptr<GlobalSinkState> PostgresUpdate::GetGlobalSinkState(ClientContext &co
 	auto &transaction = PostgresTransaction::Get(context, postgres_table.catalog);
 	auto result = make_uniq<PostgresUpdateGlobalState>(postgres_table);
 	auto &connection = transaction.GetConnection();
+	transaction.AddWrittenTable(postgres_table.schema.name, postgres_table.name);
+	Value batch_size;
+	if (context.TryGetCurrentSetting("pg_update_batch_size", batch_size)) {
+		result->batch_size = UBigIntValue::Get(batch_size);
+	}
+	bool add_row_index = result->batch_size > 0;
 	// create a temporary table to stream the update data into
 	auto table_name = "update_data_" + UUID::ToString(UUID::GenerateRandomUUID());
-	connection.Execute(CreateUpdateTable(table_name, postgres_table, columns));
+	connection.Execute(CreateUpdateTable(table_name, postgres_table, columns, add_row_index));
+	result->update_table_name = table_name;
 	// generate the final UPDATE sql
 	result->update_sql = GetUpdateSQL(table_name, postgres_table, columns);
+	// row ids are written as native tids in binary mode and as "(page,row)" strings in text mode
+	auto format = postgres_table.GetCopyFormat(context, columns);
 	// initialize the insertion chunk
 	vector<LogicalType> insert_types;
+	vector<PostgresType> insert_pg_types;
 	for (idx_t i = 0; i < columns.size(); i++) {
 		auto &col = table.GetColumn(LogicalIndex(columns[i].index));
 		insert_types.push_back(col.GetType());
+		insert_pg_types.push_back(postgres_table.postgres_types[columns[i].index]);
+	}
+	PostgresType ctid_type;
+	ctid_type.info = PostgresTypeAnnotation::CTID;
+	insert_types.push_back(format == PostgresCopyFormat::BINARY ? LogicalType::BIGINT : LogicalType::VARCHAR);
+	insert_pg_types.push_back(std::move(ctid_type));
+	if (add_row_index) {
+		insert_types.push_back(LogicalType::BIGINT);
+		insert_pg_types.push_back(PostgresType());
 	}
-	insert_types.push_back(LogicalType::VARCHAR);
 	result->insert_chunk.Initialize(context, insert_types);
 
 	// begin the COPY TO
 	string schema_name;
 	vector<string> column_names;
-	connection.BeginCopyTo(context, result->copy_state, PostgresCopyFormat::TEXT, schema_name, table_name,
-	                       column_names);
+	connection.BeginCopyTo(context, result->copy_state, format, schema_name, table_name, column_names);
+	result->copy_state.column_types = std::move(insert_pg_types);
 	return std::move(result);
 }
 
@@ -109,24 +137,36 @@ SinkResultType PostgresUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 	for (idx_t c = 0; c < columns.size(); c++) {
 		gstate.insert_chunk.data[c].Reference(chunk.data[c]);
 	}
-	// convert our row ids back into ctids
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
-	auto &ctid_vector = gstate.insert_chunk.data[gstate.insert_chunk.ColumnCount() - 1];
-	auto row_data = FlatVector::GetData<row_t>(row_identifiers);
-	auto varchar_data = FlatVector::GetData<string_t>(ctid_vector);
-
-	for (idx_t r = 0; r < chunk.size(); r++) {
-		// extract the ctid from the row id
-		auto row_in_page = row_data[r] & 0xFFFF;
-		auto page_index = row_data[r] >> 16;
-
-		string ctid_string;
-		ctid_string += "'(";
-		ctid_string += to_string(page_index);
-		ctid_string += ",";
-		ctid_string += to_string(row_in_page);
-		ctid_string += ")'";
-		varchar_data[r] = StringVector::AddString(ctid_vector, ctid_string);
+	auto &ctid_vector = gstate.insert_chunk.data[columns.size()];
+	if (gstate.copy_state.format == PostgresCopyFormat::BINARY) {
+		// the binary writer converts the row ids into tids directly
+		ctid_vector.Reference(row_identifiers);
+	} else {
+		// convert our row ids back into ctids
+		auto row_data = FlatVector::GetData<row_t>(row_identifiers);
+		auto varchar_data = FlatVector::GetData<string_t>(ctid_vector);
+		for (idx_t r = 0; r < chunk.size(); r++) {
+			// extract the ctid from the row id
+			auto row_in_page = row_data[r] & 0xFFFF;
+			auto page_index = row_data[r] >> 16;
+
+			string ctid_string;
+			ctid_string += "(";
+			ctid_string += to_string(page_index);
+			ctid_string += ",";
+			ctid_string += to_string(row_in_page);
+			ctid_string += ")";
+			varchar_data[r] = StringVector::AddString(ctid_vector, ctid_string);
+		}
+	}
+	if (gstate.batch_size > 0) {
+		// number the rows so the update can be applied in batches
+		auto &row_index_vector = gstate.insert_chunk.data[columns.size() + 1];
+		auto row_index_data = FlatVector::GetData<int64_t>(row_index_vector);
+		for (idx_t r = 0; r < chunk.size(); r++) {
+			row_index_data[r] = NumericCast<int64_t>(gstate.update_count + r);
+		}
 	}
 	gstate.insert_chunk.SetCardinality(chunk);
 
@@ -147,8 +187,24 @@ SinkFinalizeType PostgresUpdate::Finalize(Pipeline &pipeline, Event &event, Clie
 	auto &connection = transaction.GetConnection();
 	// flush the copy to state
 	connection.FinishCopyTo(gstate.copy_state);
+	auto update_table = KeywordHelper::WriteOptionallyQuoted(gstate.update_table_name);
+	// gather statistics on the update data so Postgres picks a sensible join strategy
+	connection.Execute("ANALYZE " + update_table);
 	// merge the update_info table into the actual table (i.e. perform the actual update)
-	connection.Execute(gstate.update_sql);
+	if (gstate.batch_size == 0 || gstate.update_count <= gstate.batch_size) {
+		connection.Execute(gstate.update_sql);
+		return SinkFinalizeType::READY;
+	}
+	// apply the update in batches - each statement only touches batch_size rows
+	// note that all batches are still part of the same transaction
+	connection.Execute("CREATE INDEX ON " + update_table + "(__row_index)");
+	for (idx_t start = 0; start < gstate.update_count; start += gstate.batch_size) {
+		auto end = MinValue<idx_t>(start + gstate.batch_size, gstate.update_count);
+		auto batch_sql = gstate.update_sql;
+		batch_sql += " AND " + update_table + ".__row_index >= " + to_string(start);
+		batch_sql += " AND " + update_table + ".__row_index < " + to_string(end);
+		connection.Execute(batch_sql);
+	}
 	return SinkFinalizeType::READY;
 }
 
@@ -190,6 +246,10 @@ unique_ptr<PhysicalOperator> PostgresCatalog::PlanUpdate(ClientContext &context,
 			throw BinderException("SET DEFAULT is not yet supported for updates of a Postgres table");
 		}
 	}
+	auto pushdown = PostgresDMLPushdown::TryPlanUpdate(context, op, *plan);
+	if (pushdown) {
+		return pushdown;
+	}
 	PostgresCatalog::MaterializePostgresScans(*plan);
 	auto insert = make_uniq<PostgresUpdate>(op, op.table, std::move(op.columns));
 	insert->children.push_back(std::move(plan));